@@ -0,0 +1,29 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "IVVFramework::ivv_framework" for configuration "Release"
+set_property(TARGET IVVFramework::ivv_framework APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(IVVFramework::ivv_framework PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libivv_framework.a"
+  )
+
+list(APPEND _cmake_import_check_targets IVVFramework::ivv_framework )
+list(APPEND _cmake_import_check_files_for_IVVFramework::ivv_framework "${_IMPORT_PREFIX}/lib/libivv_framework.a" )
+
+# Import target "IVVFramework::ivv_core_framework" for configuration "Release"
+set_property(TARGET IVVFramework::ivv_core_framework APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(IVVFramework::ivv_core_framework PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "CXX"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libivv_core_framework.a"
+  )
+
+list(APPEND _cmake_import_check_targets IVVFramework::ivv_core_framework )
+list(APPEND _cmake_import_check_files_for_IVVFramework::ivv_core_framework "${_IMPORT_PREFIX}/lib/libivv_core_framework.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
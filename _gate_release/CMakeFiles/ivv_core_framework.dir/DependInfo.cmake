@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/config_manager.cpp" "CMakeFiles/ivv_core_framework.dir/src/core/config_manager.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/core/config_manager.cpp.o.d"
+  "/root/repo/src/core/logger.cpp" "CMakeFiles/ivv_core_framework.dir/src/core/logger.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/core/logger.cpp.o.d"
+  "/root/repo/src/core/safety_monitor.cpp" "CMakeFiles/ivv_core_framework.dir/src/core/safety_monitor.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/core/safety_monitor.cpp.o.d"
+  "/root/repo/src/core/verifier.cpp" "CMakeFiles/ivv_core_framework.dir/src/core/verifier.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/core/verifier.cpp.o.d"
+  "/root/repo/src/fault_injection/fault_injector.cpp" "CMakeFiles/ivv_core_framework.dir/src/fault_injection/fault_injector.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/fault_injection/fault_injector.cpp.o.d"
+  "/root/repo/src/qnx_integration/qnx_platform.cpp" "CMakeFiles/ivv_core_framework.dir/src/qnx_integration/qnx_platform.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/qnx_integration/qnx_platform.cpp.o.d"
+  "/root/repo/src/timing_analysis/history_tiers.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/history_tiers.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/history_tiers.cpp.o.d"
+  "/root/repo/src/timing_analysis/jitter_tracker.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/jitter_tracker.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/jitter_tracker.cpp.o.d"
+  "/root/repo/src/timing_analysis/latency_histogram.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/latency_histogram.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/latency_histogram.cpp.o.d"
+  "/root/repo/src/timing_analysis/perf_counter_group.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/perf_counter_group.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/perf_counter_group.cpp.o.d"
+  "/root/repo/src/timing_analysis/realtime_thread.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/realtime_thread.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/realtime_thread.cpp.o.d"
+  "/root/repo/src/timing_analysis/resource_sampler.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/resource_sampler.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/resource_sampler.cpp.o.d"
+  "/root/repo/src/timing_analysis/sample_history.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/sample_history.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/sample_history.cpp.o.d"
+  "/root/repo/src/timing_analysis/sampling_engine.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/sampling_engine.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/sampling_engine.cpp.o.d"
+  "/root/repo/src/timing_analysis/shared_timing_segment.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/shared_timing_segment.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/shared_timing_segment.cpp.o.d"
+  "/root/repo/src/timing_analysis/timestamp_clock.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/timestamp_clock.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/timestamp_clock.cpp.o.d"
+  "/root/repo/src/timing_analysis/timing_analyzer.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/timing_analyzer.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/timing_analyzer.cpp.o.d"
+  "/root/repo/src/timing_analysis/trace_file.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/trace_file.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/trace_file.cpp.o.d"
+  "/root/repo/src/timing_analysis/trace_point_log.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/trace_point_log.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/trace_point_log.cpp.o.d"
+  "/root/repo/src/timing_analysis/worker_pool.cpp" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/worker_pool.cpp.o" "gcc" "CMakeFiles/ivv_core_framework.dir/src/timing_analysis/worker_pool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libivv_core_framework.a"
+)
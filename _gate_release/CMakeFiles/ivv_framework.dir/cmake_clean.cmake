@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ivv_framework.dir/src/core/config_manager.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/core/config_manager.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/core/logger.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/core/logger.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/core/safety_monitor.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/core/safety_monitor.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/core/verifier.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/core/verifier.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/fault_injection/fault_injector.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/fault_injection/fault_injector.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/qnx_integration/qnx_platform.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/qnx_integration/qnx_platform.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/history_tiers.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/history_tiers.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/jitter_tracker.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/jitter_tracker.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/latency_histogram.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/latency_histogram.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/perf_counter_group.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/perf_counter_group.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/realtime_thread.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/realtime_thread.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/resource_sampler.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/resource_sampler.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/sample_history.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/sample_history.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/sampling_engine.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/sampling_engine.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/shared_timing_segment.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/shared_timing_segment.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/timestamp_clock.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/timestamp_clock.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/timing_analyzer.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/timing_analyzer.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/trace_file.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/trace_file.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/trace_point_log.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/trace_point_log.cpp.o.d"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/worker_pool.cpp.o"
+  "CMakeFiles/ivv_framework.dir/src/timing_analysis/worker_pool.cpp.o.d"
+  "libivv_framework.a"
+  "libivv_framework.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ivv_framework.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
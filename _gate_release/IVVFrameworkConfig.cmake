@@ -0,0 +1,50 @@
+
+####### Expanded from @PACKAGE_INIT@ by configure_package_config_file() #######
+####### Any changes to this file will be overwritten by the next CMake run ####
+####### The input file was IVVFrameworkConfig.cmake.in                            ########
+
+get_filename_component(PACKAGE_PREFIX_DIR "${CMAKE_CURRENT_LIST_DIR}/../../../" ABSOLUTE)
+
+macro(set_and_check _var _file)
+  set(${_var} "${_file}")
+  if(NOT EXISTS "${_file}")
+    message(FATAL_ERROR "File or directory ${_file} referenced by variable ${_var} does not exist !")
+  endif()
+endmacro()
+
+macro(check_required_components _NAME)
+  foreach(comp ${${_NAME}_FIND_COMPONENTS})
+    if(NOT ${_NAME}_${comp}_FOUND)
+      if(${_NAME}_FIND_REQUIRED_${comp})
+        set(${_NAME}_FOUND FALSE)
+      endif()
+    endif()
+  endforeach()
+endmacro()
+
+####################################################################################
+
+# IV&V Framework CMake Configuration
+# This file is used by find_package(IVVFramework)
+
+include(CMakeFindDependencyMacro)
+
+# Find required dependencies
+find_dependency(Threads)
+
+# Include the targets file
+include(${CMAKE_CURRENT_LIST_DIR}/IVVFrameworkTargets.cmake)
+
+# Set variables for compatibility
+set(IVVFramework_VERSION 1.0.0)
+set(IVVFramework_VERSION_MAJOR 1)
+set(IVVFramework_VERSION_MINOR 0)
+set(IVVFramework_VERSION_PATCH 0)
+
+# Define the components
+set(IVVFramework_COMPONENTS Core FaultInjection TimingAnalysis RegressionTesting QNXIntegration)
+
+# Set found status
+set(IVVFramework_FOUND TRUE)
+
+check_required_components(IVVFramework)
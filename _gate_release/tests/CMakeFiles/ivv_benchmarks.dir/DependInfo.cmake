@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/benchmarks/config_manager_benchmarks.cpp" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/config_manager_benchmarks.cpp.o" "gcc" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/config_manager_benchmarks.cpp.o.d"
+  "/root/repo/tests/benchmarks/fault_injector_benchmarks.cpp" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/fault_injector_benchmarks.cpp.o" "gcc" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/fault_injector_benchmarks.cpp.o.d"
+  "/root/repo/tests/benchmarks/ivv_benchmarks.cpp" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/ivv_benchmarks.cpp.o" "gcc" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/ivv_benchmarks.cpp.o.d"
+  "/root/repo/tests/benchmarks/logger_benchmarks.cpp" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/logger_benchmarks.cpp.o" "gcc" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/logger_benchmarks.cpp.o.d"
+  "/root/repo/tests/benchmarks/safety_monitor_benchmarks.cpp" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/safety_monitor_benchmarks.cpp.o" "gcc" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/safety_monitor_benchmarks.cpp.o.d"
+  "/root/repo/tests/benchmarks/timing_analyzer_benchmarks.cpp" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/timing_analyzer_benchmarks.cpp.o" "gcc" "tests/CMakeFiles/ivv_benchmarks.dir/benchmarks/timing_analyzer_benchmarks.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_release/CMakeFiles/ivv_framework.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/config_manager_benchmarks.cpp.o"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/config_manager_benchmarks.cpp.o.d"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/fault_injector_benchmarks.cpp.o"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/fault_injector_benchmarks.cpp.o.d"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/ivv_benchmarks.cpp.o"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/ivv_benchmarks.cpp.o.d"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/logger_benchmarks.cpp.o"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/logger_benchmarks.cpp.o.d"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/safety_monitor_benchmarks.cpp.o"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/safety_monitor_benchmarks.cpp.o.d"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/timing_analyzer_benchmarks.cpp.o"
+  "CMakeFiles/ivv_benchmarks.dir/benchmarks/timing_analyzer_benchmarks.cpp.o.d"
+  "ivv_benchmarks"
+  "ivv_benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ivv_benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
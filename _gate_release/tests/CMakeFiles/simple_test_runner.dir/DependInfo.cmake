@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/fault_injection/test_fault_injector_simple.cpp" "tests/CMakeFiles/simple_test_runner.dir/fault_injection/test_fault_injector_simple.cpp.o" "gcc" "tests/CMakeFiles/simple_test_runner.dir/fault_injection/test_fault_injector_simple.cpp.o.d"
+  "/root/repo/tests/simple_test_runner.cpp" "tests/CMakeFiles/simple_test_runner.dir/simple_test_runner.cpp.o" "gcc" "tests/CMakeFiles/simple_test_runner.dir/simple_test_runner.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_release/CMakeFiles/ivv_framework.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple_test_runner.dir/fault_injection/test_fault_injector_simple.cpp.o"
+  "CMakeFiles/simple_test_runner.dir/fault_injection/test_fault_injector_simple.cpp.o.d"
+  "CMakeFiles/simple_test_runner.dir/simple_test_runner.cpp.o"
+  "CMakeFiles/simple_test_runner.dir/simple_test_runner.cpp.o.d"
+  "simple_test_runner"
+  "simple_test_runner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_test_runner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/timing_analysis/test_timing_analyzer_simple.cpp" "tests/CMakeFiles/timing_analysis_test.dir/timing_analysis/test_timing_analyzer_simple.cpp.o" "gcc" "tests/CMakeFiles/timing_analysis_test.dir/timing_analysis/test_timing_analyzer_simple.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_release/CMakeFiles/ivv_framework.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
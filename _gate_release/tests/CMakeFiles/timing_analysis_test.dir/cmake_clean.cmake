@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timing_analysis_test.dir/timing_analysis/test_timing_analyzer_simple.cpp.o"
+  "CMakeFiles/timing_analysis_test.dir/timing_analysis/test_timing_analyzer_simple.cpp.o.d"
+  "timing_analysis_test"
+  "timing_analysis_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timing_analysis_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timing_contention_benchmark.dir/benchmarks/timing_contention_benchmark.cpp.o"
+  "CMakeFiles/timing_contention_benchmark.dir/benchmarks/timing_contention_benchmark.cpp.o.d"
+  "timing_contention_benchmark"
+  "timing_contention_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timing_contention_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
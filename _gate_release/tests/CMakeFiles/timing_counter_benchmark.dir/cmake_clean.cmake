@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timing_counter_benchmark.dir/benchmarks/timing_counter_benchmark.cpp.o"
+  "CMakeFiles/timing_counter_benchmark.dir/benchmarks/timing_counter_benchmark.cpp.o.d"
+  "timing_counter_benchmark"
+  "timing_counter_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timing_counter_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
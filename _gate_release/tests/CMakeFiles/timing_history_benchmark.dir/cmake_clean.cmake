@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timing_history_benchmark.dir/benchmarks/timing_history_benchmark.cpp.o"
+  "CMakeFiles/timing_history_benchmark.dir/benchmarks/timing_history_benchmark.cpp.o.d"
+  "timing_history_benchmark"
+  "timing_history_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timing_history_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
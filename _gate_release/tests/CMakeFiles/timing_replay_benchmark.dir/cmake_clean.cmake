@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timing_replay_benchmark.dir/benchmarks/timing_replay_benchmark.cpp.o"
+  "CMakeFiles/timing_replay_benchmark.dir/benchmarks/timing_replay_benchmark.cpp.o.d"
+  "timing_replay_benchmark"
+  "timing_replay_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timing_replay_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timing_report_benchmark.dir/benchmarks/timing_report_benchmark.cpp.o"
+  "CMakeFiles/timing_report_benchmark.dir/benchmarks/timing_report_benchmark.cpp.o.d"
+  "timing_report_benchmark"
+  "timing_report_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timing_report_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timing_sampling_benchmark.dir/benchmarks/timing_sampling_benchmark.cpp.o"
+  "CMakeFiles/timing_sampling_benchmark.dir/benchmarks/timing_sampling_benchmark.cpp.o.d"
+  "timing_sampling_benchmark"
+  "timing_sampling_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timing_sampling_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
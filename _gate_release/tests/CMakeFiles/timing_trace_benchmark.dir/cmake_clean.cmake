@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timing_trace_benchmark.dir/benchmarks/timing_trace_benchmark.cpp.o"
+  "CMakeFiles/timing_trace_benchmark.dir/benchmarks/timing_trace_benchmark.cpp.o.d"
+  "timing_trace_benchmark"
+  "timing_trace_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timing_trace_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
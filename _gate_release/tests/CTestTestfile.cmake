@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_gate_release/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(TimingAnalysisTests "/root/repo/_gate_release/tests/timing_analysis_test")
+set_tests_properties(TimingAnalysisTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;31;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(SimpleTests "/root/repo/_gate_release/tests/simple_test_runner")
+set_tests_properties(SimpleTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;150;add_test;/root/repo/tests/CMakeLists.txt;0;")
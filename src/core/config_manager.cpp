@@ -147,29 +147,32 @@ ConfigManager::ConfigManager() : pimpl_(std::make_unique<Impl>()) {}
 ConfigManager::~ConfigManager() = default;
 
 bool ConfigManager::initialize(const std::string &config_file_path) {
-  std::lock_guard<std::mutex> lock(pimpl_->config_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(pimpl_->config_mutex_);
 
-  // Register default safety-critical parameters
-  auto default_params = ConfigUtils::create_default_safety_parameters();
-  for (const auto &param : default_params) {
-    pimpl_->parameter_definitions_[param.name] = param;
-    if (!param.default_value.empty()) {
-      pimpl_->parameters_[param.name] = param.default_value;
+    // Register default safety-critical parameters
+    auto default_params = ConfigUtils::create_default_safety_parameters();
+    for (const auto &param : default_params) {
+      pimpl_->parameter_definitions_[param.name] = param;
+      if (!param.default_value.empty()) {
+        pimpl_->parameters_[param.name] = param.default_value;
+      }
     }
-  }
 
-  // Load configuration file if provided
-  if (!config_file_path.empty()) {
-    if (!pimpl_->load_from_file(config_file_path)) {
-      return false;
+    // Load configuration file if provided
+    if (!config_file_path.empty()) {
+      if (!pimpl_->load_from_file(config_file_path)) {
+        return false;
+      }
     }
   }
 
-  // Validate all parameters
+  // Validate all parameters (takes the lock itself)
   if (!validate_all_parameters()) {
     return false;
   }
 
+  std::lock_guard<std::mutex> lock(pimpl_->config_mutex_);
   pimpl_->initialized_ = true;
   return true;
 }
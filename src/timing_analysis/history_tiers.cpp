@@ -0,0 +1,141 @@
+/**
+ * @file history_tiers.cpp
+ * @brief Downsampled timing history tiers implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "history_tiers.h"
+#include <algorithm>
+#include <limits>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+constexpr int64_t kSecondNs = 1000000000;
+constexpr int64_t kMinuteNs = 60 * kSecondNs;
+
+// Intervals allocated beyond a tier's age, so the background compaction
+// can lag a little before the tier retires intervals itself
+constexpr size_t kTierSlack = 2;
+
+int64_t floor_to(int64_t value, int64_t width) noexcept {
+  int64_t quotient = value / width;
+  if (value % width < 0) {
+    --quotient;
+  }
+  return quotient * width;
+}
+
+} // anonymous namespace
+
+void HistoryTiers::configure(const RetentionPolicy &policy) {
+  enabled_ = policy.second_tier_age.count() > 0 ||
+             policy.minute_tier_age.count() > 0;
+  histogram_config_ = policy.tier_histogram;
+  expired_count_ = 0;
+  configure_tier(seconds_, kSecondNs, policy.second_tier_age.count());
+  configure_tier(minutes_, kMinuteNs, policy.minute_tier_age.count());
+}
+
+void HistoryTiers::configure_tier(Tier &tier, int64_t width_ns,
+                                  int64_t age_ns) {
+  std::vector<Interval> ring;
+  if (age_ns > 0) {
+    Interval prototype;
+    prototype.width_ns = width_ns;
+    prototype.histogram = LatencyHistogram(histogram_config_);
+    ring.assign(static_cast<size_t>((age_ns + width_ns - 1) / width_ns) +
+                    kTierSlack,
+                prototype);
+  }
+
+  tier.ring.swap(ring);
+  tier.width_ns = width_ns;
+  tier.age_ns = (age_ns > 0) ? age_ns : 0;
+  tier.head = 0;
+  tier.size = 0;
+}
+
+void HistoryTiers::add(int64_t start_ns, int64_t execution_ns,
+                       bool deadline_met) noexcept {
+  if (!enabled_) {
+    return;
+  }
+
+  Tier &tier = (seconds_.age_ns > 0) ? seconds_ : minutes_;
+  Interval *interval = open_interval(tier, start_ns);
+  interval->stats.add(execution_ns, deadline_met);
+  interval->histogram.record(std::chrono::nanoseconds(execution_ns));
+}
+
+void HistoryTiers::compact(int64_t newest_ns) noexcept {
+  // Seconds are rolled up before minutes expire, so a second never skips
+  // the minute tier
+  for (Tier *tier : {&seconds_, &minutes_}) {
+    if (tier->age_ns == 0) {
+      continue;
+    }
+    int64_t cutoff = newest_ns - tier->age_ns;
+    while (tier->size > 0 &&
+           tier->at(0).start_ns + tier->width_ns <= cutoff) {
+      retire_oldest(*tier);
+    }
+  }
+}
+
+void HistoryTiers::clear() noexcept {
+  for (Tier *tier : {&seconds_, &minutes_}) {
+    tier->head = 0;
+    tier->size = 0;
+  }
+  expired_count_ = 0;
+}
+
+uint64_t HistoryTiers::sample_count() const noexcept {
+  uint64_t count = 0;
+  for_each_since(std::numeric_limits<int64_t>::min(),
+                 [&count](const Interval &interval) {
+                   count += interval.stats.count;
+                 });
+  return count;
+}
+
+HistoryTiers::Interval *HistoryTiers::open_interval(Tier &tier,
+                                                    int64_t start_ns) noexcept {
+  int64_t key = floor_to(start_ns, tier.width_ns);
+  if (tier.size > 0 && key <= tier.at(tier.size - 1).start_ns) {
+    return &tier.at(tier.size - 1);
+  }
+
+  if (tier.size == tier.ring.size()) {
+    retire_oldest(tier);
+  }
+  Interval &created = tier.at(tier.size);
+  created.start_ns = key;
+  created.stats.clear();
+  created.histogram.clear();
+  ++tier.size;
+  return &created;
+}
+
+void HistoryTiers::retire_oldest(Tier &tier) noexcept {
+  Interval &oldest = tier.at(0);
+  if (&tier == &seconds_ && minutes_.age_ns > 0) {
+    Interval *minute = open_interval(minutes_, oldest.start_ns);
+    minute->stats.merge(oldest.stats);
+    minute->histogram.merge(oldest.histogram);
+  } else {
+    expired_count_ += oldest.stats.count;
+  }
+
+  tier.head = (tier.head + 1) % tier.ring.size();
+  --tier.size;
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
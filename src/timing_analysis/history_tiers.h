@@ -0,0 +1,147 @@
+/**
+ * @file history_tiers.h
+ * @brief Downsampled per-second and per-minute tiers of old timing history
+ *
+ * Samples leaving a component's raw history are folded into per-second
+ * aggregates; per-second aggregates older than their retention age are in
+ * turn rolled up into per-minute aggregates, which expire after theirs.
+ * Every aggregate keeps count, mean, deviation, extrema, deadline misses
+ * and a coarse latency histogram, so long windows can still be analyzed
+ * with memory bounded by the tier ages rather than the sample rate.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include "latency_histogram.h"
+#include "running_statistics.h"
+#include "timing_analyzer.h"
+#include <cstdint>
+#include <vector>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @class HistoryTiers
+ * @brief Fixed-capacity rings of per-second and per-minute aggregates
+ *
+ * Aggregate storage, histograms included, is preallocated when the tiers
+ * are configured, so folding a sample in never allocates. Ages are
+ * measured against the newest sample time seen, as for the raw history.
+ *
+ * Thread Safety: not thread-safe; callers provide external locking.
+ */
+class HistoryTiers {
+public:
+  /// Aggregate of the samples that started within one interval
+  struct Interval {
+    int64_t start_ns = 0; ///< Interval start in steady_clock nanoseconds
+    int64_t width_ns = 0; ///< One second or one minute
+    RunningStatistics stats;
+    LatencyHistogram histogram;
+  };
+
+  HistoryTiers() = default;
+
+  /**
+   * @brief Apply the tier settings of a retention policy
+   * @param policy Policy whose second_tier_age and minute_tier_age size the
+   *        tiers; both 0 disables downsampling
+   *
+   * Aggregates held so far are discarded.
+   */
+  void configure(const RetentionPolicy &policy);
+
+  /**
+   * @brief Whether samples are downsampled rather than dropped
+   */
+  bool enabled() const noexcept { return enabled_; }
+
+  /**
+   * @brief Fold a sample that left the raw history into the finest tier
+   *
+   * Samples older than the newest interval of the tier join that interval,
+   * as the raw history's buckets do. When the tier is full, its oldest
+   * interval is rolled up or expired right away.
+   */
+  void add(int64_t start_ns, int64_t execution_ns, bool deadline_met) noexcept;
+
+  /**
+   * @brief Roll up and expire aggregates past their tier's age
+   * @param newest_ns Newest sample start time of the component
+   */
+  void compact(int64_t newest_ns) noexcept;
+
+  /**
+   * @brief Discard all aggregates and reset counters
+   */
+  void clear() noexcept;
+
+  /**
+   * @brief Visit the aggregates of intervals starting at or after a time
+   * @param cutoff_ns Earliest interval start in steady_clock nanoseconds
+   * @param visitor Callable taking const Interval&, called oldest first
+   */
+  template <typename Visitor>
+  void for_each_since(int64_t cutoff_ns, Visitor &&visitor) const {
+    for (const Tier *tier : {&minutes_, &seconds_}) {
+      for (size_t i = 0; i < tier->size; ++i) {
+        const Interval &interval = tier->at(i);
+        if (interval.start_ns >= cutoff_ns) {
+          visitor(interval);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Number of samples aggregated and not yet expired
+   */
+  uint64_t sample_count() const noexcept;
+
+  /**
+   * @brief Number of samples whose aggregates expired
+   */
+  uint64_t expired_count() const noexcept { return expired_count_; }
+
+  /**
+   * @brief Histogram layout of every aggregate
+   */
+  const HistogramConfig &histogram_config() const noexcept {
+    return histogram_config_;
+  }
+
+private:
+  /// Ring of consecutive intervals of one width, oldest first
+  struct Tier {
+    int64_t width_ns = 0;
+    int64_t age_ns = 0; ///< Retention age; 0 when the tier is unused
+    std::vector<Interval> ring;
+    size_t head = 0;
+    size_t size = 0;
+
+    Interval &at(size_t index) noexcept {
+      return ring[(head + index) % ring.size()];
+    }
+    const Interval &at(size_t index) const noexcept {
+      return ring[(head + index) % ring.size()];
+    }
+  };
+
+  void configure_tier(Tier &tier, int64_t width_ns, int64_t age_ns);
+  Interval *open_interval(Tier &tier, int64_t start_ns) noexcept;
+  void retire_oldest(Tier &tier) noexcept;
+
+  bool enabled_ = false;
+  HistogramConfig histogram_config_;
+  Tier seconds_;
+  Tier minutes_;
+  uint64_t expired_count_ = 0;
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
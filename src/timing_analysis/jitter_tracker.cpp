@@ -0,0 +1,122 @@
+/**
+ * @file jitter_tracker.cpp
+ * @brief Incremental inter-arrival jitter tracking implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "jitter_tracker.h"
+#include <algorithm>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+JitterTracker::JitterTracker(size_t window) { set_window(window); }
+
+void JitterTracker::set_window(size_t window) {
+  std::vector<int64_t> intervals(window);
+  std::vector<uint64_t> min_entries(window);
+  std::vector<uint64_t> max_entries(window);
+
+  window_ = window;
+  intervals_.swap(intervals);
+  min_queue_.entries.swap(min_entries);
+  max_queue_.entries.swap(max_entries);
+  clear();
+}
+
+void JitterTracker::clear() noexcept {
+  has_last_ = false;
+  count_ = 0;
+  sum_ns_ = 0;
+  min_ns_ = 0;
+  max_ns_ = 0;
+  next_sequence_ = 0;
+  min_queue_.head = 0;
+  min_queue_.size = 0;
+  max_queue_.head = 0;
+  max_queue_.size = 0;
+}
+
+std::chrono::nanoseconds
+JitterTracker::add(std::chrono::steady_clock::time_point start_time) noexcept {
+  if (!has_last_) {
+    has_last_ = true;
+    last_start_ = start_time;
+    return std::chrono::nanoseconds{0};
+  }
+
+  // An activation reported after a later one, e.g. stopped late on
+  // another thread, forms no interval
+  if (start_time < last_start_) {
+    return jitter();
+  }
+
+  int64_t interval = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         start_time - last_start_)
+                         .count();
+  last_start_ = start_time;
+
+  if (window_ > 0) {
+    add_windowed(interval);
+  } else {
+    min_ns_ = (count_ == 0) ? interval : std::min(min_ns_, interval);
+    max_ns_ = (count_ == 0) ? interval : std::max(max_ns_, interval);
+    sum_ns_ += interval;
+    ++count_;
+  }
+
+  return jitter();
+}
+
+void JitterTracker::add_windowed(int64_t interval) noexcept {
+  uint64_t sequence = next_sequence_++;
+
+  // Retire the interval leaving the window before its slot is overwritten
+  if (count_ == window_) {
+    uint64_t expired = sequence - window_;
+    sum_ns_ -= interval_at(expired);
+    if (min_queue_.size > 0 && min_queue_.front() == expired) {
+      min_queue_.pop_front();
+    }
+    if (max_queue_.size > 0 && max_queue_.front() == expired) {
+      max_queue_.pop_front();
+    }
+  } else {
+    ++count_;
+  }
+
+  intervals_[static_cast<size_t>(sequence % window_)] = interval;
+  sum_ns_ += interval;
+
+  while (min_queue_.size > 0 && interval_at(min_queue_.back()) >= interval) {
+    min_queue_.pop_back();
+  }
+  min_queue_.push_back(sequence);
+  while (max_queue_.size > 0 && interval_at(max_queue_.back()) <= interval) {
+    max_queue_.pop_back();
+  }
+  max_queue_.push_back(sequence);
+
+  min_ns_ = interval_at(min_queue_.front());
+  max_ns_ = interval_at(max_queue_.front());
+}
+
+std::chrono::nanoseconds JitterTracker::mean_interval() const noexcept {
+  return std::chrono::nanoseconds(
+      (count_ > 0) ? sum_ns_ / static_cast<int64_t>(count_) : 0);
+}
+
+std::chrono::nanoseconds JitterTracker::jitter() const noexcept {
+  if (count_ < 2) {
+    return std::chrono::nanoseconds{0};
+  }
+
+  int64_t mean = sum_ns_ / static_cast<int64_t>(count_);
+  return std::chrono::nanoseconds(std::max(max_ns_ - mean, mean - min_ns_));
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,127 @@
+/**
+ * @file jitter_tracker.h
+ * @brief Incremental inter-arrival jitter tracking for timing analysis
+ *
+ * Jitter is the largest deviation of an inter-arrival interval from the
+ * mean interval, i.e. max(max_interval - mean, mean - min_interval). The
+ * tracker maintains the interval sum and extrema per sample instead of
+ * rescanning the measurement history.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @class JitterTracker
+ * @brief Constant-time inter-arrival jitter over all or the last N intervals
+ *
+ * With a window of 0 every interval since the last clear contributes. With
+ * a window of N only the last N intervals contribute; extrema are kept in
+ * preallocated monotonic queues, so each sample costs amortized O(1) and
+ * never allocates.
+ *
+ * Thread Safety: not thread-safe; callers provide external locking.
+ */
+class JitterTracker {
+public:
+  /**
+   * @brief Construct a tracker and preallocate its window storage
+   * @param window Number of intervals to track (0 = unbounded)
+   */
+  explicit JitterTracker(size_t window = 0);
+
+  /**
+   * @brief Change the interval window; discards tracked intervals
+   * @param window Number of intervals to track (0 = unbounded)
+   */
+  void set_window(size_t window);
+
+  /**
+   * @brief Interval window in effect (0 = unbounded)
+   */
+  size_t window() const noexcept { return window_; }
+
+  /**
+   * @brief Account for a new activation
+   * @param start_time Start time of the new sample
+   * @return Jitter including the interval ending at start_time; an
+   *         activation starting before the previous one is not counted
+   */
+  std::chrono::nanoseconds
+  add(std::chrono::steady_clock::time_point start_time) noexcept;
+
+  /**
+   * @brief Current jitter (zero until two intervals are known)
+   */
+  std::chrono::nanoseconds jitter() const noexcept;
+
+  /**
+   * @brief Mean interval over the tracked intervals
+   */
+  std::chrono::nanoseconds mean_interval() const noexcept;
+
+  /**
+   * @brief Number of intervals currently contributing
+   */
+  uint64_t interval_count() const noexcept { return count_; }
+
+  /**
+   * @brief Forget all activations
+   */
+  void clear() noexcept;
+
+private:
+  int64_t interval_at(uint64_t sequence) const noexcept {
+    return intervals_[static_cast<size_t>(sequence % window_)];
+  }
+
+  /// Fixed-capacity double-ended queue of interval sequence numbers
+  struct SequenceQueue {
+    std::vector<uint64_t> entries;
+    size_t head = 0;
+    size_t size = 0;
+
+    uint64_t front() const noexcept { return entries[head]; }
+    uint64_t back() const noexcept {
+      return entries[(head + size - 1) % entries.size()];
+    }
+    void pop_front() noexcept {
+      head = (head + 1 == entries.size()) ? 0 : head + 1;
+      --size;
+    }
+    void pop_back() noexcept { --size; }
+    void push_back(uint64_t sequence) noexcept {
+      entries[(head + size) % entries.size()] = sequence;
+      ++size;
+    }
+  };
+
+  void add_windowed(int64_t interval) noexcept;
+
+  size_t window_ = 0;
+  bool has_last_ = false;
+  std::chrono::steady_clock::time_point last_start_;
+  uint64_t count_ = 0; ///< Intervals contributing to the statistics
+  int64_t sum_ns_ = 0; ///< Sum of contributing intervals
+  int64_t min_ns_ = 0;
+  int64_t max_ns_ = 0;
+
+  // Windowed mode only
+  uint64_t next_sequence_ = 0;
+  std::vector<int64_t> intervals_; ///< Ring indexed by sequence % window
+  SequenceQueue min_queue_;        ///< Increasing interval values
+  SequenceQueue max_queue_;        ///< Decreasing interval values
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,229 @@
+/**
+ * @file latency_histogram.cpp
+ * @brief Log-linear latency histogram implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "latency_histogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+/**
+ * @brief Index of the highest set bit; value must be non-zero
+ */
+unsigned highest_bit(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#else
+  unsigned bit = 0;
+  while (value >>= 1) {
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+} // anonymous namespace
+
+LatencyHistogram::LatencyHistogram(const HistogramConfig &config)
+    : config_(config) {
+  config_.precision_bits = std::min(std::max(config_.precision_bits, 2u), 16u);
+  if (config_.max_trackable.count() < 2) {
+    config_.max_trackable = std::chrono::nanoseconds(2);
+  }
+
+  sub_bucket_half_bits_ = config_.precision_bits - 1;
+  sub_bucket_count_ = uint64_t{1} << config_.precision_bits;
+  sub_bucket_half_count_ = sub_bucket_count_ >> 1;
+  max_trackable_ = static_cast<uint64_t>(config_.max_trackable.count());
+
+  // Bucket 0 covers [0, sub_bucket_count) linearly; each further bucket
+  // doubles the range and adds sub_bucket_half_count counters
+  size_t length = static_cast<size_t>(sub_bucket_count_);
+  if (max_trackable_ >= sub_bucket_count_) {
+    unsigned top_bucket = highest_bit(max_trackable_) - sub_bucket_half_bits_;
+    length += static_cast<size_t>(top_bucket) *
+              static_cast<size_t>(sub_bucket_half_count_);
+  }
+  counts_.assign(length, 0);
+}
+
+size_t LatencyHistogram::index_for(uint64_t value) const noexcept {
+  if (value < sub_bucket_count_) {
+    return static_cast<size_t>(value);
+  }
+  unsigned bucket = highest_bit(value) - sub_bucket_half_bits_;
+  uint64_t sub_bucket = value >> bucket;
+  return static_cast<size_t>(uint64_t{bucket} * sub_bucket_half_count_ +
+                             sub_bucket);
+}
+
+uint64_t LatencyHistogram::lowest_equivalent_value(size_t index) const
+    noexcept {
+  // Buckets cover consecutive value ranges in index order
+  return (index == 0) ? 0 : highest_equivalent_value(index - 1) + 1;
+}
+
+uint64_t LatencyHistogram::highest_equivalent_value(size_t index) const
+    noexcept {
+  uint64_t position = static_cast<uint64_t>(index);
+  if (position < sub_bucket_count_) {
+    return position;
+  }
+  uint64_t offset = position - sub_bucket_count_;
+  unsigned bucket =
+      static_cast<unsigned>(offset >> sub_bucket_half_bits_) + 1u;
+  uint64_t sub_bucket =
+      (offset & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+  return ((sub_bucket + 1) << bucket) - 1;
+}
+
+void LatencyHistogram::record(std::chrono::nanoseconds value,
+                              uint64_t count) noexcept {
+  if (count == 0) {
+    return;
+  }
+
+  uint64_t raw =
+      (value.count() > 0) ? static_cast<uint64_t>(value.count()) : 0;
+  if (raw > max_trackable_) {
+    raw = max_trackable_;
+    overflow_count_ += count;
+  }
+
+  counts_[index_for(raw)] += count;
+  total_count_ += count;
+  min_recorded_ = std::min(min_recorded_, raw);
+  max_recorded_ = std::max(max_recorded_, raw);
+}
+
+void LatencyHistogram::record_with_expected_interval(
+    std::chrono::nanoseconds value,
+    std::chrono::nanoseconds expected_interval) noexcept {
+  record(value);
+  if (expected_interval.count() <= 0 || value <= expected_interval) {
+    return;
+  }
+
+  uint64_t interval = static_cast<uint64_t>(expected_interval.count());
+  uint64_t missing = static_cast<uint64_t>(value.count()) - interval;
+  uint64_t remaining = missing / interval;
+  while (remaining > 0) {
+    // The run of back-filled values down to the bottom of this bucket, or
+    // down to max_trackable while above it
+    uint64_t bottom = (missing > max_trackable_)
+                          ? max_trackable_ + 1
+                          : lowest_equivalent_value(index_for(missing));
+    uint64_t run = std::min(remaining, (missing - bottom) / interval + 1);
+    record(std::chrono::nanoseconds(static_cast<int64_t>(missing)), run);
+    uint64_t lowest = missing - (run - 1) * interval;
+    min_recorded_ = std::min(min_recorded_, std::min(lowest, max_trackable_));
+    missing = lowest - interval;
+    remaining -= run;
+  }
+}
+
+bool LatencyHistogram::merge(const LatencyHistogram &other) noexcept {
+  if (other.config_.precision_bits != config_.precision_bits ||
+      other.counts_.size() != counts_.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  total_count_ += other.total_count_;
+  overflow_count_ += other.overflow_count_;
+  min_recorded_ = std::min(min_recorded_, other.min_recorded_);
+  max_recorded_ = std::max(max_recorded_, other.max_recorded_);
+  return true;
+}
+
+void LatencyHistogram::clear() noexcept {
+  std::fill(counts_.begin(), counts_.end(), 0);
+  total_count_ = 0;
+  overflow_count_ = 0;
+  min_recorded_ = UINT64_MAX;
+  max_recorded_ = 0;
+}
+
+std::chrono::nanoseconds LatencyHistogram::min_value() const noexcept {
+  return std::chrono::nanoseconds(
+      (total_count_ > 0) ? static_cast<int64_t>(min_recorded_) : 0);
+}
+
+std::chrono::nanoseconds LatencyHistogram::max_value() const noexcept {
+  return std::chrono::nanoseconds(static_cast<int64_t>(max_recorded_));
+}
+
+std::chrono::nanoseconds
+LatencyHistogram::value_at_percentile(double percentile) const noexcept {
+  if (total_count_ == 0) {
+    return std::chrono::nanoseconds{0};
+  }
+
+  double clamped = std::min(std::max(percentile, 0.0), 1.0);
+  uint64_t target = static_cast<uint64_t>(
+      std::ceil(clamped * static_cast<double>(total_count_)));
+  target = std::min(std::max<uint64_t>(target, 1), total_count_);
+
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    cumulative += counts_[i];
+    if (cumulative >= target) {
+      uint64_t value = std::min(highest_equivalent_value(i), max_recorded_);
+      value = std::max(value, min_recorded_);
+      return std::chrono::nanoseconds(static_cast<int64_t>(value));
+    }
+  }
+  return max_value();
+}
+
+std::vector<std::chrono::nanoseconds> LatencyHistogram::values_at_percentiles(
+    const std::vector<double> &percentiles) const {
+  std::vector<std::chrono::nanoseconds> result(percentiles.size(),
+                                               std::chrono::nanoseconds{0});
+  if (total_count_ == 0 || percentiles.empty()) {
+    return result;
+  }
+
+  // Visit the requested percentiles in ascending order during one walk
+  std::vector<size_t> order(percentiles.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return percentiles[a] < percentiles[b];
+  });
+
+  size_t next = 0;
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < counts_.size() && next < order.size(); ++i) {
+    cumulative += counts_[i];
+    while (next < order.size()) {
+      double clamped = std::min(std::max(percentiles[order[next]], 0.0), 1.0);
+      uint64_t target = static_cast<uint64_t>(
+          std::ceil(clamped * static_cast<double>(total_count_)));
+      target = std::min(std::max<uint64_t>(target, 1), total_count_);
+      if (cumulative < target) {
+        break;
+      }
+      uint64_t value = std::min(highest_equivalent_value(i), max_recorded_);
+      value = std::max(value, min_recorded_);
+      result[order[next]] = std::chrono::nanoseconds(static_cast<int64_t>(value));
+      ++next;
+    }
+  }
+  return result;
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
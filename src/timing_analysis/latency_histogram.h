@@ -0,0 +1,154 @@
+/**
+ * @file latency_histogram.h
+ * @brief Fixed-memory log-linear latency histogram for timing percentiles
+ *
+ * HDR-style histogram: values are bucketed by power of two, and each power
+ * of two is split into 2^(precision_bits - 1) linear sub-buckets, giving a
+ * bounded relative error over a nanosecond-to-seconds range in a few KB.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @brief Latency histogram layout
+ */
+struct HistogramConfig {
+  unsigned precision_bits = 6; ///< Sub-bucket bits; relative error 2^(1-bits)
+  std::chrono::nanoseconds max_trackable{
+      std::chrono::seconds(60)}; ///< Larger values are clamped and counted
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief Log-linear bucketed histogram with constant-size storage
+ *
+ * Recording is O(1). Percentile queries walk the fixed bucket array, so
+ * their cost is independent of the number of recorded samples. Histograms
+ * with identical layouts can be merged, e.g. to combine per-thread
+ * recorders.
+ *
+ * Thread Safety: not thread-safe; callers provide external locking.
+ */
+class LatencyHistogram {
+public:
+  /**
+   * @brief Construct an empty histogram
+   * @param config Histogram layout; precision_bits is clamped to [2, 16]
+   */
+  explicit LatencyHistogram(const HistogramConfig &config = HistogramConfig{});
+
+  /**
+   * @brief Record a value
+   * @param value Latency to record; negative values are recorded as zero
+   * @param count Number of occurrences to record
+   */
+  void record(std::chrono::nanoseconds value, uint64_t count = 1) noexcept;
+
+  /**
+   * @brief Record a value, correcting for coordinated omission
+   * @param value Latency to record
+   * @param expected_interval Interval between releases; 0 records the value
+   *        alone
+   *
+   * A value exceeding expected_interval delayed the releases that fell due
+   * meanwhile, which never got measured. As in HdrHistogram, those are
+   * back-filled with value - interval, value - 2 * interval, ... down to
+   * expected_interval. Back-filled values sharing a bucket are recorded
+   * together, so the cost is bounded by the bucket count rather than by
+   * value / expected_interval.
+   */
+  void record_with_expected_interval(
+      std::chrono::nanoseconds value,
+      std::chrono::nanoseconds expected_interval) noexcept;
+
+  /**
+   * @brief Add another histogram's counts to this one
+   * @param other Histogram with the same layout
+   * @return true if merged, false if the layouts differ
+   */
+  bool merge(const LatencyHistogram &other) noexcept;
+
+  /**
+   * @brief Remove all recorded values
+   */
+  void clear() noexcept;
+
+  /**
+   * @brief Value at a percentile
+   * @param percentile Percentile to query (0.0 to 1.0)
+   * @return Highest value equivalent to the bucket holding the percentile,
+   *         bounded by the largest recorded value
+   */
+  std::chrono::nanoseconds value_at_percentile(double percentile) const
+      noexcept;
+
+  /**
+   * @brief Values at several percentiles in one pass
+   * @param percentiles Percentiles to query (0.0 to 1.0)
+   * @return Values in the order requested
+   */
+  std::vector<std::chrono::nanoseconds>
+  values_at_percentiles(const std::vector<double> &percentiles) const;
+
+  /**
+   * @brief Number of recorded values
+   */
+  uint64_t total_count() const noexcept { return total_count_; }
+
+  /**
+   * @brief Number of recorded values clamped to max_trackable
+   */
+  uint64_t overflow_count() const noexcept { return overflow_count_; }
+
+  /**
+   * @brief Smallest recorded value (zero when empty)
+   */
+  std::chrono::nanoseconds min_value() const noexcept;
+
+  /**
+   * @brief Largest recorded value (zero when empty)
+   */
+  std::chrono::nanoseconds max_value() const noexcept;
+
+  /**
+   * @brief Histogram layout
+   */
+  const HistogramConfig &config() const noexcept { return config_; }
+
+  /**
+   * @brief Bytes used by the bucket array
+   */
+  size_t memory_footprint() const noexcept {
+    return counts_.size() * sizeof(uint64_t);
+  }
+
+private:
+  size_t index_for(uint64_t value) const noexcept;
+  uint64_t lowest_equivalent_value(size_t index) const noexcept;
+  uint64_t highest_equivalent_value(size_t index) const noexcept;
+
+  HistogramConfig config_;
+  unsigned sub_bucket_half_bits_ = 0;
+  uint64_t sub_bucket_count_ = 0;
+  uint64_t sub_bucket_half_count_ = 0;
+  uint64_t max_trackable_ = 0;
+  std::vector<uint64_t> counts_;
+  uint64_t total_count_ = 0;
+  uint64_t overflow_count_ = 0;
+  uint64_t min_recorded_ = UINT64_MAX;
+  uint64_t max_recorded_ = 0;
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,123 @@
+/**
+ * @file lock_free_ring.h
+ * @brief Bounded lock-free queues used on the timing measurement path
+ *
+ * Provides a single-producer/single-consumer ring buffer with preallocated
+ * storage. Producers never allocate or block; consumers drain in batches.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/// Cache line size used to keep producer and consumer indices apart
+constexpr size_t kCacheLineSize = 64;
+
+/**
+ * @class SpscRing
+ * @brief Fixed-capacity single-producer/single-consumer ring buffer
+ *
+ * Elements are assigned into preallocated slots, so element types that own
+ * heap storage (e.g. std::string) reuse their capacity once warmed up.
+ *
+ * Thread Safety: exactly one thread may push and exactly one thread may
+ * drain at any time. Ownership of either side may move between threads
+ * provided the hand-over is externally synchronized.
+ *
+ * @tparam T Element type, must be default constructible and copy assignable
+ */
+template <typename T> class SpscRing {
+public:
+  /**
+   * @brief Construct a ring with at least the requested capacity
+   * @param capacity Minimum capacity, rounded up to a power of two
+   */
+  explicit SpscRing(size_t capacity) {
+    size_t rounded = 1;
+    while (rounded < capacity) {
+      rounded <<= 1;
+    }
+    capacity_ = rounded;
+    mask_ = rounded - 1;
+    buffer_ = std::make_unique<T[]>(rounded);
+  }
+
+  SpscRing(const SpscRing &) = delete;
+  SpscRing &operator=(const SpscRing &) = delete;
+
+  /**
+   * @brief Push an element (producer side)
+   * @param value Element to copy into the ring
+   * @return true if pushed, false if the ring is full
+   */
+  bool try_push(const T &value) noexcept {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ >= capacity_) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ >= capacity_) {
+        return false;
+      }
+    }
+    buffer_[tail & mask_] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Drain currently visible elements (consumer side)
+   * @param consumer Callable invoked with a const reference to each element
+   * @param limit Most elements to drain, oldest first
+   * @return Number of elements drained
+   */
+  template <typename Consumer>
+  size_t drain(Consumer &&consumer,
+               size_t limit = std::numeric_limits<size_t>::max()) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    const size_t count =
+        std::min(tail_.load(std::memory_order_acquire) - head, limit);
+    const size_t tail = head + count;
+    for (; head != tail; ++head) {
+      consumer(static_cast<const T &>(buffer_[head & mask_]));
+    }
+    head_.store(head, std::memory_order_release);
+    return count;
+  }
+
+  /**
+   * @brief Approximate number of queued elements
+   * @return Element count as seen by the calling thread
+   */
+  size_t size_approx() const noexcept {
+    return tail_.load(std::memory_order_acquire) -
+           head_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Ring capacity
+   * @return Maximum number of queued elements
+   */
+  size_t capacity() const noexcept { return capacity_; }
+
+private:
+  std::unique_ptr<T[]> buffer_;
+  size_t capacity_ = 0;
+  size_t mask_ = 0;
+
+  alignas(kCacheLineSize) std::atomic<size_t> head_{0}; ///< Consumer index
+  alignas(kCacheLineSize) std::atomic<size_t> tail_{0}; ///< Producer index
+  size_t head_cache_ = 0; ///< Producer-local view of head_
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,192 @@
+/**
+ * @file perf_counter_group.cpp
+ * @brief Per-thread perf_event counter group implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "perf_counter_group.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+#ifdef __linux__
+
+int open_event(uint32_t type, uint64_t config, int group_fd,
+               bool user_only) noexcept {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.read_format = PERF_FORMAT_GROUP;
+  attr.exclude_kernel = user_only ? 1 : 0;
+  attr.exclude_hv = 1;
+
+  // pid 0 and cpu -1: the calling thread on whichever CPU it runs
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd,
+                                  PERF_FLAG_FD_CLOEXEC));
+}
+
+#endif
+
+void add_fields(PerformanceCounters &total,
+                const PerformanceCounters &counters) noexcept {
+  total.cycles += counters.cycles;
+  total.instructions += counters.instructions;
+  total.cache_misses += counters.cache_misses;
+  total.context_switches += counters.context_switches;
+  total.cpu_migrations += counters.cpu_migrations;
+  total.task_clock_ns += counters.task_clock_ns;
+  total.valid = true;
+  total.hardware = total.hardware || counters.hardware;
+}
+
+void max_fields(PerformanceCounters &maximum,
+                const PerformanceCounters &counters) noexcept {
+  maximum.cycles = std::max(maximum.cycles, counters.cycles);
+  maximum.instructions = std::max(maximum.instructions, counters.instructions);
+  maximum.cache_misses = std::max(maximum.cache_misses, counters.cache_misses);
+  maximum.context_switches =
+      std::max(maximum.context_switches, counters.context_switches);
+  maximum.cpu_migrations =
+      std::max(maximum.cpu_migrations, counters.cpu_migrations);
+  maximum.task_clock_ns =
+      std::max(maximum.task_clock_ns, counters.task_clock_ns);
+  maximum.valid = true;
+  maximum.hardware = maximum.hardware || counters.hardware;
+}
+
+} // anonymous namespace
+
+bool PerfCounterGroup::open() noexcept {
+  close();
+
+#ifdef __linux__
+  int leader = open_event(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, -1,
+                          false);
+  if (leader < 0) {
+    return false;
+  }
+  fds_[TASK_CLOCK] = leader;
+  position_[TASK_CLOCK] = member_count_++;
+
+  struct Member {
+    Counter counter;
+    uint32_t type;
+    uint64_t config;
+  };
+  const Member members[] = {
+      {CONTEXT_SWITCHES, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+      {CPU_MIGRATIONS, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CPU_MIGRATIONS},
+      {CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {CACHE_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+  };
+
+  // Context switches are counted in the kernel, so only hardware counters
+  // are restricted to user space
+  for (const Member &member : members) {
+    bool hardware = (member.type == PERF_TYPE_HARDWARE);
+    int fd = open_event(member.type, member.config, leader, hardware);
+    if (fd < 0) {
+      continue; // No PMU (e.g. in a VM) or the event is not supported
+    }
+    fds_[member.counter] = fd;
+    position_[member.counter] = member_count_++;
+    hardware_ = hardware_ || hardware;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void PerfCounterGroup::close() noexcept {
+#ifdef __linux__
+  // Members before the leader
+  for (size_t i = 0; i < COUNTER_COUNT; ++i) {
+    if (i != TASK_CLOCK && fds_[i] >= 0) {
+      ::close(fds_[i]);
+    }
+  }
+  if (fds_[TASK_CLOCK] >= 0) {
+    ::close(fds_[TASK_CLOCK]);
+  }
+#endif
+  fds_.fill(-1);
+  member_count_ = 0;
+  hardware_ = false;
+}
+
+bool PerfCounterGroup::read(Reading &reading) const noexcept {
+#ifdef __linux__
+  if (!is_open()) {
+    return false;
+  }
+
+  // PERF_FORMAT_GROUP layout: nr, then one value per member in group order
+  uint64_t buffer[1 + COUNTER_COUNT];
+  ssize_t length = ::read(fds_[TASK_CLOCK], buffer, sizeof(buffer));
+  if (length < static_cast<ssize_t>(sizeof(uint64_t)) ||
+      buffer[0] != member_count_) {
+    return false;
+  }
+  std::copy(buffer + 1, buffer + 1 + member_count_, reading.values.begin());
+  return true;
+#else
+  (void)reading;
+  return false;
+#endif
+}
+
+void PerfCounterGroup::delta(const Reading &start, const Reading &end,
+                             PerformanceCounters &counters) const noexcept {
+  auto value = [&](Counter counter) -> uint64_t {
+    if (fds_[counter] < 0) {
+      return 0;
+    }
+    size_t position = position_[counter];
+    return end.values[position] - start.values[position];
+  };
+
+  counters.cycles = value(CYCLES);
+  counters.instructions = value(INSTRUCTIONS);
+  counters.cache_misses = value(CACHE_MISSES);
+  counters.context_switches = value(CONTEXT_SWITCHES);
+  counters.cpu_migrations = value(CPU_MIGRATIONS);
+  counters.task_clock_ns = value(TASK_CLOCK);
+  counters.valid = true;
+  counters.hardware = hardware_;
+}
+
+void accumulate_counters(PerformanceCounterStatistics &stats,
+                         const PerformanceCounters &counters,
+                         bool deadline_met) noexcept {
+  if (!counters.valid) {
+    return;
+  }
+
+  ++stats.sample_count;
+  add_fields(stats.total, counters);
+  max_fields(stats.maximum, counters);
+  if (!deadline_met) {
+    ++stats.missed_sample_count;
+    add_fields(stats.missed_total, counters);
+  }
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,113 @@
+/**
+ * @file perf_counter_group.h
+ * @brief Per-thread perf_event counter group for timing measurements
+ *
+ * Opens cycles, instructions, cache-miss, context-switch, migration and
+ * task-clock counters for the calling thread as one perf_event group, so
+ * every counter is read with a single system call.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include "timing_analyzer.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @class PerfCounterGroup
+ * @brief Counter group bound to the thread that opened it
+ *
+ * The software task-clock counter leads the group and the context-switch
+ * and migration counters always join it. Hardware counters join when the
+ * PMU is accessible and are restricted to user space so they open under
+ * the default perf_event_paranoid setting.
+ *
+ * Thread Safety: open() and read() must be called by the owning thread.
+ */
+class PerfCounterGroup {
+public:
+  /// Counters in the group, in PerformanceCounters field order
+  enum Counter : size_t {
+    CYCLES,
+    INSTRUCTIONS,
+    CACHE_MISSES,
+    CONTEXT_SWITCHES,
+    CPU_MIGRATIONS,
+    TASK_CLOCK,
+    COUNTER_COUNT
+  };
+
+  /// Raw group values in group order
+  struct Reading {
+    std::array<uint64_t, COUNTER_COUNT> values{};
+  };
+
+  PerfCounterGroup() { fds_.fill(-1); }
+  ~PerfCounterGroup() { close(); }
+  PerfCounterGroup(const PerfCounterGroup &) = delete;
+  PerfCounterGroup &operator=(const PerfCounterGroup &) = delete;
+
+  /**
+   * @brief Open the counter group for the calling thread
+   * @return true if at least the software counters are open
+   */
+  bool open() noexcept;
+
+  /**
+   * @brief Close all counters
+   */
+  void close() noexcept;
+
+  /**
+   * @brief Whether the group is open
+   */
+  bool is_open() const noexcept { return fds_[TASK_CLOCK] >= 0; }
+
+  /**
+   * @brief Whether hardware counters are part of the group
+   */
+  bool has_hardware() const noexcept { return hardware_; }
+
+  /**
+   * @brief Read every counter with one system call
+   * @param reading Receives the raw group values
+   * @return false if the group is closed or the read failed
+   */
+  bool read(Reading &reading) const noexcept;
+
+  /**
+   * @brief Convert two readings into per-measurement deltas
+   * @param start Reading taken at measurement start
+   * @param end Reading taken at measurement stop
+   * @param counters Receives the deltas
+   */
+  void delta(const Reading &start, const Reading &end,
+             PerformanceCounters &counters) const noexcept;
+
+private:
+  std::array<int, COUNTER_COUNT> fds_;        ///< -1 when not open
+  std::array<size_t, COUNTER_COUNT> position_{}; ///< Index in group order
+  size_t member_count_ = 0;
+  bool hardware_ = false;
+};
+
+/**
+ * @brief Add one sample's counters to a component aggregate
+ * @param stats Aggregate to update
+ * @param counters Counter deltas of the sample; ignored unless valid
+ * @param deadline_met Whether the sample met its deadline
+ */
+void accumulate_counters(PerformanceCounterStatistics &stats,
+                         const PerformanceCounters &counters,
+                         bool deadline_met) noexcept;
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,182 @@
+/**
+ * @file realtime_thread.cpp
+ * @brief Linux real-time scheduling helpers implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "realtime_thread.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#ifdef __linux__
+#include <alloca.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+/// Read the first line of a sysfs file; empty if it cannot be read
+std::string read_sysfs_line(const char *path) {
+  std::ifstream file(path);
+  std::string line;
+  std::getline(file, line);
+  return line;
+}
+
+std::string errno_text(const char *operation, int error) {
+  return std::string(operation) + ": " + std::strerror(error);
+}
+
+} // anonymous namespace
+
+std::vector<int> parse_cpu_list(const std::string &list) {
+  std::vector<int> cpus;
+  std::stringstream ranges(list);
+  std::string range;
+  while (std::getline(ranges, range, ',')) {
+    range.erase(std::remove_if(range.begin(), range.end(),
+                               [](unsigned char c) { return std::isspace(c); }),
+                range.end());
+    if (range.empty()) {
+      continue;
+    }
+
+    int first = 0;
+    int last = 0;
+    char dash = 0;
+    std::stringstream parser(range);
+    if (!(parser >> first) || first < 0) {
+      return {};
+    }
+    last = first;
+    if (parser >> dash) {
+      if (dash != '-' || !(parser >> last) || last < first) {
+        return {};
+      }
+    }
+    for (int cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+std::vector<int> online_cpus() {
+  std::vector<int> cpus =
+      parse_cpu_list(read_sysfs_line("/sys/devices/system/cpu/online"));
+#ifdef __linux__
+  if (cpus.empty()) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    for (int cpu = 0; cpu < count; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+#endif
+  return cpus;
+}
+
+std::vector<int> housekeeping_cpus() {
+  std::vector<int> online = online_cpus();
+  std::vector<int> isolated =
+      parse_cpu_list(read_sysfs_line("/sys/devices/system/cpu/isolated"));
+
+  std::vector<int> housekeeping;
+  std::set_difference(online.begin(), online.end(), isolated.begin(),
+                      isolated.end(), std::back_inserter(housekeeping));
+  return housekeeping.empty() ? online : housekeeping;
+}
+
+ThreadSchedulingResult apply_thread_scheduling(pthread_t thread,
+                                               const RealtimeConfig &config,
+                                               const std::vector<int> &cpus) {
+  ThreadSchedulingResult result;
+
+#ifdef __linux__
+  sched_param param{};
+  int policy = SCHED_OTHER;
+  if (config.policy == SchedulingPolicy::FIFO) {
+    policy = SCHED_FIFO;
+    param.sched_priority =
+        std::clamp(config.priority, sched_get_priority_min(SCHED_FIFO),
+                   sched_get_priority_max(SCHED_FIFO));
+  }
+
+  int error = pthread_setschedparam(thread, policy, &param);
+  result.scheduling = (error == 0);
+  if (error != 0) {
+    result.error = errno_text("pthread_setschedparam", error);
+  }
+
+  if (cpus.empty()) {
+    result.affinity = true;
+    return result;
+  }
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+      CPU_SET(static_cast<size_t>(cpu), &set);
+    }
+  }
+  error = pthread_setaffinity_np(thread, sizeof(set), &set);
+  result.affinity = (error == 0);
+  if (error != 0 && result.error.empty()) {
+    result.error = errno_text("pthread_setaffinity_np", error);
+  }
+#else
+  (void)thread;
+  (void)config;
+  (void)cpus;
+  result.error = "real-time scheduling is only supported on Linux";
+#endif
+
+  return result;
+}
+
+bool lock_process_memory(bool lock, std::string &error) {
+#ifdef __linux__
+  int status = lock ? mlockall(MCL_CURRENT | MCL_FUTURE) : munlockall();
+  if (status != 0) {
+    error = errno_text(lock ? "mlockall" : "munlockall", errno);
+    return false;
+  }
+  return true;
+#else
+  (void)lock;
+  error = "memory locking is only supported on Linux";
+  return false;
+#endif
+}
+
+void prefault_stack(size_t bytes) noexcept {
+#ifdef __linux__
+  // Write one byte per page; volatile keeps the stores
+  volatile char *stack = static_cast<volatile char *>(alloca(bytes));
+  size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  for (size_t offset = 0; offset < bytes; offset += page) {
+    stack[offset] = 0;
+  }
+#else
+  (void)bytes;
+#endif
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
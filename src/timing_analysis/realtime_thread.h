@@ -0,0 +1,83 @@
+/**
+ * @file realtime_thread.h
+ * @brief Linux real-time scheduling helpers for background threads
+ *
+ * Applies a RealtimeConfig to one thread (scheduling policy, priority and
+ * CPU affinity), locks process memory and determines the housekeeping CPUs
+ * from the kernel's isolated CPU list. Every function reports failures
+ * instead of throwing, so callers can degrade gracefully when capabilities
+ * such as CAP_SYS_NICE or CAP_IPC_LOCK are missing.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include "timing_analyzer.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <pthread.h>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/// Stack bytes touched per thread when RealtimeConfig::prefault_stacks is set
+constexpr size_t kStackPrefaultBytes = size_t{256} << 10;
+
+/**
+ * @brief Outcome of applying a RealtimeConfig to one thread
+ */
+struct ThreadSchedulingResult {
+  bool scheduling = false; ///< Policy and priority applied
+  bool affinity = false;   ///< CPU affinity applied
+  std::string error;       ///< First failure, empty on success
+};
+
+/**
+ * @brief Parse a kernel CPU list such as "0-3,8,10-11"
+ * @param list CPU list text; surrounding whitespace is ignored
+ * @return CPUs in ascending order; empty for an empty or malformed list
+ */
+std::vector<int> parse_cpu_list(const std::string &list);
+
+/**
+ * @brief Online CPUs that are not isolated from the scheduler
+ * @return Housekeeping CPUs, or all online CPUs when every CPU is isolated
+ */
+std::vector<int> housekeeping_cpus();
+
+/**
+ * @brief All online CPUs
+ */
+std::vector<int> online_cpus();
+
+/**
+ * @brief Apply scheduling policy, priority and affinity to a thread
+ * @param thread Target thread
+ * @param config Policy and priority to apply
+ * @param cpus CPUs to pin to; empty leaves the affinity unchanged
+ */
+ThreadSchedulingResult apply_thread_scheduling(pthread_t thread,
+                                               const RealtimeConfig &config,
+                                               const std::vector<int> &cpus);
+
+/**
+ * @brief Lock or unlock all current and future pages of the process
+ * @param lock true for mlockall(), false for munlockall()
+ * @param error Receives the failure reason
+ * @return true on success
+ */
+bool lock_process_memory(bool lock, std::string &error);
+
+/**
+ * @brief Touch the calling thread's stack so later use does not page-fault
+ * @param bytes Stack bytes to touch
+ */
+void prefault_stack(size_t bytes) noexcept;
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,440 @@
+/**
+ * @file resource_sampler.cpp
+ * @brief Built-in process resource sampler implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "resource_sampler.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <system_error>
+#include <thread>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+#ifdef __linux__
+
+/// Large enough for /proc/<pid>/task/<tid>/stat including a 16-byte comm
+constexpr size_t kProcBufferSize = 1024;
+
+/// Read a whole /proc file from offset 0 into a NUL-terminated buffer
+bool read_proc(int fd, char *buffer, size_t size) noexcept {
+  if (fd < 0) {
+    return false;
+  }
+  ssize_t length = pread(fd, buffer, size - 1, 0);
+  if (length <= 0) {
+    return false;
+  }
+  buffer[length] = '\0';
+  return true;
+}
+
+/// Skip whitespace-separated fields
+const char *skip_fields(const char *cursor, int count) noexcept {
+  for (int i = 0; i < count && *cursor != '\0'; ++i) {
+    while (*cursor == ' ') {
+      ++cursor;
+    }
+    while (*cursor != ' ' && *cursor != '\0') {
+      ++cursor;
+    }
+  }
+  return cursor;
+}
+
+/// Parse an unsigned decimal field and advance past it
+uint64_t parse_u64(const char *&cursor) noexcept {
+  while (*cursor == ' ') {
+    ++cursor;
+  }
+  uint64_t value = 0;
+  while (*cursor >= '0' && *cursor <= '9') {
+    value = value * 10 + static_cast<uint64_t>(*cursor - '0');
+    ++cursor;
+  }
+  return value;
+}
+
+uint64_t timeval_ns(const timeval &time) noexcept {
+  return static_cast<uint64_t>(time.tv_sec) * 1000000000ULL +
+         static_cast<uint64_t>(time.tv_usec) * 1000ULL;
+}
+
+uint64_t saturating_sub(uint64_t a, uint64_t b) noexcept {
+  return (a > b) ? a - b : 0;
+}
+
+int open_task_file(int thread_id, const char *name) noexcept {
+  char path[64];
+  std::snprintf(path, sizeof(path), "/proc/self/task/%d/%s", thread_id, name);
+  return open(path, O_RDONLY | O_CLOEXEC);
+}
+
+#endif
+
+} // anonymous namespace
+
+bool ResourceSampler::supported() noexcept {
+#ifdef __linux__
+  return true;
+#else
+  return false;
+#endif
+}
+
+SampledResource
+ResourceSampler::resource_for(const std::string &resource_name) {
+  std::string lower(resource_name);
+  std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  });
+  return (lower == "memory") ? SampledResource::MEMORY : SampledResource::CPU;
+}
+
+bool ResourceSampler::run(SampledResource resource,
+                          std::chrono::nanoseconds duration, double sample_rate,
+                          ResourceUtilization &result,
+                          const std::function<void()> &thread_setup) {
+  if (!supported() || !(sample_rate > 0.0)) {
+    return false;
+  }
+
+  sample_rate = std::min(sample_rate, kMaxSampleRate);
+  auto interval = std::chrono::nanoseconds(
+      static_cast<int64_t>(1.0e9 / sample_rate));
+  duration = std::max(duration, std::chrono::nanoseconds(0));
+
+  // Preallocate the series so the sampling loop never grows it
+  size_t expected = static_cast<size_t>(duration.count() / interval.count());
+  result.utilization_samples.clear();
+  result.utilization_samples.reserve(expected + 2);
+  result.thread_utilization.clear();
+
+  started_ = false;
+  try {
+    std::thread sampler([&]() {
+      if (thread_setup) {
+        thread_setup();
+      }
+#ifdef __linux__
+      int sampler_thread_id = static_cast<int>(syscall(SYS_gettid));
+      try {
+        started_ = open_probes(sampler_thread_id);
+        if (started_) {
+          result.thread_utilization.resize(threads_.size());
+          for (size_t i = 0; i < threads_.size(); ++i) {
+            ThreadUtilization &thread = result.thread_utilization[i];
+            thread.thread_id = threads_[i].thread_id;
+
+            char name[64];
+            int comm_fd = open_task_file(threads_[i].thread_id, "comm");
+            if (read_proc(comm_fd, name, sizeof(name))) {
+              thread.thread_name = name;
+              if (!thread.thread_name.empty() &&
+                  thread.thread_name.back() == '\n') {
+                thread.thread_name.pop_back();
+              }
+            }
+            if (comm_fd >= 0) {
+              close(comm_fd);
+            }
+          }
+        }
+      } catch (const std::exception &) {
+        started_ = false;
+      }
+
+      if (started_) {
+        sample_loop(resource, duration, interval, result);
+      }
+      close_probes();
+#else
+      (void)resource;
+#endif
+    });
+    sampler.join();
+  } catch (const std::system_error &) {
+    return false;
+  }
+
+  return started_;
+}
+
+bool ResourceSampler::open_probes(int sampler_thread_id) {
+#ifdef __linux__
+  threads_.clear();
+  statm_fd_ = open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+
+  DIR *tasks = opendir("/proc/self/task");
+  if (tasks == nullptr) {
+    return false;
+  }
+
+  while (dirent *entry = readdir(tasks)) {
+    int thread_id = std::atoi(entry->d_name);
+    if (thread_id <= 0 || thread_id == sampler_thread_id) {
+      continue;
+    }
+
+    ThreadProbe probe;
+    probe.thread_id = thread_id;
+    probe.stat_fd = open_task_file(thread_id, "stat");
+    if (probe.stat_fd < 0) {
+      continue; // Thread exited while enumerating
+    }
+    probe.schedstat_fd = open_task_file(thread_id, "schedstat");
+    threads_.push_back(probe);
+  }
+  closedir(tasks);
+
+  std::sort(threads_.begin(), threads_.end(),
+            [](const ThreadProbe &a, const ThreadProbe &b) {
+              return a.thread_id < b.thread_id;
+            });
+  return true;
+#else
+  (void)sampler_thread_id;
+  return false;
+#endif
+}
+
+void ResourceSampler::close_probes() noexcept {
+#ifdef __linux__
+  for (auto &probe : threads_) {
+    if (probe.stat_fd >= 0) {
+      close(probe.stat_fd);
+    }
+    if (probe.schedstat_fd >= 0) {
+      close(probe.schedstat_fd);
+    }
+  }
+  if (statm_fd_ >= 0) {
+    close(statm_fd_);
+  }
+#endif
+  threads_.clear();
+  statm_fd_ = -1;
+}
+
+bool ResourceSampler::read_process(ProcessCounters &counters) const noexcept {
+#ifdef __linux__
+  // Process totals minus the sampler thread's own usage
+  rusage process{};
+  rusage sampler{};
+  if (getrusage(RUSAGE_SELF, &process) != 0 ||
+      getrusage(RUSAGE_THREAD, &sampler) != 0) {
+    return false;
+  }
+
+  counters.cpu_ns = saturating_sub(
+      timeval_ns(process.ru_utime) + timeval_ns(process.ru_stime),
+      timeval_ns(sampler.ru_utime) + timeval_ns(sampler.ru_stime));
+  counters.minor_faults =
+      saturating_sub(static_cast<uint64_t>(process.ru_minflt),
+                     static_cast<uint64_t>(sampler.ru_minflt));
+  counters.major_faults =
+      saturating_sub(static_cast<uint64_t>(process.ru_majflt),
+                     static_cast<uint64_t>(sampler.ru_majflt));
+  counters.voluntary_switches =
+      saturating_sub(static_cast<uint64_t>(process.ru_nvcsw),
+                     static_cast<uint64_t>(sampler.ru_nvcsw));
+  counters.involuntary_switches =
+      saturating_sub(static_cast<uint64_t>(process.ru_nivcsw),
+                     static_cast<uint64_t>(sampler.ru_nivcsw));
+
+  // statm: size resident shared text lib data dt, in pages
+  char buffer[kProcBufferSize];
+  if (read_proc(statm_fd_, buffer, sizeof(buffer))) {
+    const char *cursor = skip_fields(buffer, 1);
+    counters.rss_bytes =
+        parse_u64(cursor) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  }
+  return true;
+#else
+  (void)counters;
+  return false;
+#endif
+}
+
+bool ResourceSampler::read_thread(ThreadProbe &probe, uint64_t &cpu_ns,
+                                  uint64_t &minor_faults,
+                                  uint64_t &major_faults) const noexcept {
+#ifdef __linux__
+  char buffer[kProcBufferSize];
+  if (!probe.alive || !read_proc(probe.stat_fd, buffer, sizeof(buffer))) {
+    probe.alive = false; // Reads fail with ESRCH once the thread exits
+    return false;
+  }
+
+  // Fields after the parenthesized comm start at field 3 (state):
+  // minflt is field 10, majflt 12, utime 14 and stime 15
+  const char *cursor = buffer;
+  for (const char *c = buffer; *c != '\0'; ++c) {
+    if (*c == ')') {
+      cursor = c + 1;
+    }
+  }
+  cursor = skip_fields(cursor, 7);
+  minor_faults = parse_u64(cursor);
+  cursor = skip_fields(cursor, 1);
+  major_faults = parse_u64(cursor);
+  cursor = skip_fields(cursor, 1);
+  uint64_t ticks = parse_u64(cursor);
+  ticks += parse_u64(cursor);
+
+  // schedstat run time has nanosecond resolution, stat only clock ticks
+  char schedstat[128];
+  if (read_proc(probe.schedstat_fd, schedstat, sizeof(schedstat))) {
+    const char *run_time = schedstat;
+    cpu_ns = parse_u64(run_time);
+  } else {
+    cpu_ns = ticks * (1000000000ULL /
+                      static_cast<uint64_t>(sysconf(_SC_CLK_TCK)));
+  }
+  return true;
+#else
+  (void)probe;
+  (void)cpu_ns;
+  (void)minor_faults;
+  (void)major_faults;
+  return false;
+#endif
+}
+
+void ResourceSampler::sample_loop(SampledResource resource,
+                                  std::chrono::nanoseconds duration,
+                                  std::chrono::nanoseconds interval,
+                                  ResourceUtilization &result) noexcept {
+#ifdef __linux__
+  double online_cpus =
+      static_cast<double>(std::max<long>(sysconf(_SC_NPROCESSORS_ONLN), 1));
+  double physical_bytes =
+      static_cast<double>(sysconf(_SC_PHYS_PAGES)) *
+      static_cast<double>(sysconf(_SC_PAGESIZE));
+
+  ProcessCounters first;
+  read_process(first);
+  for (auto &probe : threads_) {
+    read_thread(probe, probe.first_cpu_ns, probe.first_minor_faults,
+                probe.first_major_faults);
+    probe.last_cpu_ns = probe.first_cpu_ns;
+    probe.last_minor_faults = probe.first_minor_faults;
+    probe.last_major_faults = probe.first_major_faults;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto end = start + duration;
+  auto next = start;
+  auto previous_time = start;
+  ProcessCounters previous = first;
+  ProcessCounters current = first;
+  double sum = 0.0;
+  size_t count = 0;
+
+  do {
+    next = std::min(next + interval, end);
+    std::this_thread::sleep_until(next);
+
+    auto now = std::chrono::steady_clock::now();
+    double elapsed_ns =
+        std::chrono::duration<double, std::nano>(now - previous_time).count();
+    if (elapsed_ns <= 0.0 || !read_process(current)) {
+      continue;
+    }
+
+    double value = 0.0;
+    if (resource == SampledResource::MEMORY) {
+      value = (physical_bytes > 0.0)
+                  ? static_cast<double>(current.rss_bytes) / physical_bytes *
+                        100.0
+                  : 0.0;
+    } else {
+      value = static_cast<double>(
+                  saturating_sub(current.cpu_ns, previous.cpu_ns)) /
+              elapsed_ns * 100.0 / online_cpus;
+    }
+
+    if (result.utilization_samples.size() <
+        result.utilization_samples.capacity()) {
+      result.utilization_samples.push_back(value);
+    }
+    sum += value;
+    ++count;
+    result.peak_utilization = std::max(result.peak_utilization, value);
+    result.peak_rss_bytes = std::max(result.peak_rss_bytes, current.rss_bytes);
+
+    for (auto &probe : threads_) {
+      uint64_t cpu_ns = 0;
+      uint64_t minor_faults = 0;
+      uint64_t major_faults = 0;
+      if (!read_thread(probe, cpu_ns, minor_faults, major_faults)) {
+        continue;
+      }
+      double thread_cpu =
+          static_cast<double>(saturating_sub(cpu_ns, probe.last_cpu_ns)) /
+          elapsed_ns * 100.0;
+      probe.peak_cpu = std::max(probe.peak_cpu, thread_cpu);
+      probe.last_cpu_ns = cpu_ns;
+      probe.last_minor_faults = minor_faults;
+      probe.last_major_faults = major_faults;
+    }
+
+    previous = current;
+    previous_time = now;
+  } while (next < end);
+
+  double window_ns = std::chrono::duration<double, std::nano>(
+                         previous_time - start)
+                         .count();
+  result.average_utilization = (count > 0) ? sum / static_cast<double>(count)
+                                           : 0.0;
+  result.minor_page_faults =
+      saturating_sub(previous.minor_faults, first.minor_faults);
+  result.major_page_faults =
+      saturating_sub(previous.major_faults, first.major_faults);
+  result.voluntary_context_switches =
+      saturating_sub(previous.voluntary_switches, first.voluntary_switches);
+  result.involuntary_context_switches = saturating_sub(
+      previous.involuntary_switches, first.involuntary_switches);
+
+  for (size_t i = 0; i < threads_.size(); ++i) {
+    const ThreadProbe &probe = threads_[i];
+    ThreadUtilization &thread = result.thread_utilization[i];
+    thread.average_cpu =
+        (window_ns > 0.0)
+            ? static_cast<double>(probe.last_cpu_ns - probe.first_cpu_ns) /
+                  window_ns * 100.0
+            : 0.0;
+    thread.peak_cpu = probe.peak_cpu;
+    thread.minor_page_faults =
+        saturating_sub(probe.last_minor_faults, probe.first_minor_faults);
+    thread.major_page_faults =
+        saturating_sub(probe.last_major_faults, probe.first_major_faults);
+  }
+#else
+  (void)resource;
+  (void)duration;
+  (void)interval;
+  (void)result;
+#endif
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
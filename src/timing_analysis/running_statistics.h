@@ -0,0 +1,108 @@
+/**
+ * @file running_statistics.h
+ * @brief Incremental execution-time aggregates for timing analysis
+ *
+ * Maintains count, mean, variance (Welford), extrema and deadline misses in
+ * constant time per sample, so statistics can be reported without
+ * rescanning the measurement history.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @struct RunningStatistics
+ * @brief Online mean/variance/min/max accumulator over execution times
+ *
+ * Thread Safety: not thread-safe; callers provide external locking.
+ */
+struct RunningStatistics {
+  uint64_t count = 0;           ///< Number of samples accumulated
+  uint64_t deadline_misses = 0; ///< Samples that missed their deadline
+  double mean_ns = 0.0;         ///< Running mean execution time
+  double m2 = 0.0;              ///< Sum of squared deviations from the mean
+  int64_t min_ns = std::numeric_limits<int64_t>::max(); ///< Minimum seen
+  int64_t max_ns = std::numeric_limits<int64_t>::min(); ///< Maximum seen
+
+  /**
+   * @brief Accumulate one sample
+   * @param execution_ns Execution time in nanoseconds
+   * @param deadline_met Whether the sample met its deadline
+   */
+  void add(int64_t execution_ns, bool deadline_met) noexcept {
+    ++count;
+    double value = static_cast<double>(execution_ns);
+    double delta = value - mean_ns;
+    mean_ns += delta / static_cast<double>(count);
+    m2 += delta * (value - mean_ns);
+    min_ns = std::min(min_ns, execution_ns);
+    max_ns = std::max(max_ns, execution_ns);
+    if (!deadline_met) {
+      ++deadline_misses;
+    }
+  }
+
+  /**
+   * @brief Combine another accumulator into this one (Chan et al.)
+   * @param other Accumulator to merge
+   */
+  void merge(const RunningStatistics &other) noexcept {
+    if (other.count == 0) {
+      return;
+    }
+    if (count == 0) {
+      *this = other;
+      return;
+    }
+
+    double total = static_cast<double>(count + other.count);
+    double delta = other.mean_ns - mean_ns;
+    mean_ns += delta * static_cast<double>(other.count) / total;
+    m2 += other.m2 + delta * delta * static_cast<double>(count) *
+                         static_cast<double>(other.count) / total;
+    count += other.count;
+    deadline_misses += other.deadline_misses;
+    min_ns = std::min(min_ns, other.min_ns);
+    max_ns = std::max(max_ns, other.max_ns);
+  }
+
+  /**
+   * @brief Reset to the empty state
+   */
+  void clear() noexcept { *this = RunningStatistics{}; }
+
+  /**
+   * @brief Population variance of the accumulated samples
+   */
+  double variance() const noexcept {
+    return (count > 0) ? m2 / static_cast<double>(count) : 0.0;
+  }
+
+  /**
+   * @brief Population standard deviation of the accumulated samples
+   */
+  double std_deviation() const noexcept { return std::sqrt(variance()); }
+
+  /**
+   * @brief Fraction of samples that missed their deadline
+   */
+  double deadline_miss_rate() const noexcept {
+    return (count > 0) ? static_cast<double>(deadline_misses) /
+                             static_cast<double>(count)
+                       : 0.0;
+  }
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
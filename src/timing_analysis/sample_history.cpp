@@ -0,0 +1,358 @@
+/**
+ * @file sample_history.cpp
+ * @brief Bounded per-component measurement history implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "sample_history.h"
+#include <algorithm>
+#include <bitset>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+int64_t to_ns(std::chrono::steady_clock::time_point time) noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+std::chrono::steady_clock::time_point from_ns(int64_t ns) noexcept {
+  return std::chrono::steady_clock::time_point(
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::nanoseconds(ns)));
+}
+
+size_t popcount(uint64_t word) noexcept {
+  return std::bitset<64>(word).count();
+}
+
+} // anonymous namespace
+
+SampleHistory::SampleHistory(ComponentId component,
+                             const RetentionPolicy &policy)
+    : component_(component), policy_(policy),
+      capacity_(std::max<size_t>(policy.max_samples, 1)),
+      execution_ns_(capacity_), start_ns_(capacity_), jitter_ns_(capacity_),
+      miss_bits_((capacity_ + 63) / 64) {
+  tiers_.configure(policy_);
+}
+
+void SampleHistory::set_policy(const RetentionPolicy &policy) {
+  size_t capacity = std::max<size_t>(policy.max_samples, 1);
+  std::vector<int64_t> execution_ns(capacity);
+  std::vector<int64_t> start_ns(capacity);
+  std::vector<int64_t> jitter_ns(capacity);
+  std::vector<uint64_t> miss_bits((capacity + 63) / 64);
+
+  // Aggregates restart under the new tier layout; samples that no longer
+  // fit the capacity are the first folded into it
+  tiers_.configure(policy);
+  size_t keep = std::min(size_, capacity);
+  for (size_t i = 0; i < size_ - keep; ++i) {
+    size_t source = position(i);
+    tiers_.add(start_ns_[source], execution_ns_[source], deadline_met(i));
+  }
+
+  // Keep the newest samples that fit the new capacity
+  for (size_t i = 0; i < keep; ++i) {
+    size_t source = position(size_ - keep + i);
+    execution_ns[i] = execution_ns_[source];
+    start_ns[i] = start_ns_[source];
+    jitter_ns[i] = jitter_ns_[source];
+    if (!deadline_met(size_ - keep + i)) {
+      miss_bits[i / 64] |= uint64_t{1} << (i % 64);
+    }
+  }
+
+  evicted_count_ += size_ - keep;
+  policy_ = policy;
+  capacity_ = capacity;
+  execution_ns_.swap(execution_ns);
+  start_ns_.swap(start_ns);
+  jitter_ns_.swap(jitter_ns);
+  miss_bits_.swap(miss_bits);
+  head_ = 0;
+  size_ = keep;
+  rebuild_buckets();
+}
+
+void SampleHistory::append(const TimingSample &sample) {
+  int64_t start = to_ns(sample.start_time);
+  int64_t execution = sample.execution_time.count();
+  newest_start_ns_ = std::max(newest_start_ns_, start);
+
+  // Ages are measured against the newest start, so a late sample does not
+  // hold older ones back
+  if (policy_.max_age.count() > 0) {
+    int64_t cutoff = newest_start_ns_ - policy_.max_age.count();
+    while (size_ > 0 && start_ns_[head_] < cutoff) {
+      evict_oldest();
+    }
+    if (start < cutoff) {
+      evict_late(start, execution, sample.deadline_met);
+      return;
+    }
+  }
+
+  // A sample starting before retained ones goes to its start-time position,
+  // after samples that started at the same time
+  size_t index = (size_ > 0 && start < start_ns(size_ - 1))
+                     ? lower_bound(start + 1)
+                     : size_;
+  if (size_ == capacity_) {
+    if (index == 0) {
+      evict_late(start, execution, sample.deadline_met);
+      return;
+    }
+    evict_oldest();
+    --index;
+  }
+
+  if (index < size_) {
+    insert_at(index, start, sample);
+  } else {
+    size_t physical = position(size_);
+    execution_ns_[physical] = execution;
+    start_ns_[physical] = start;
+    jitter_ns_[physical] = sample.jitter.count();
+    set_deadline_met(physical, sample.deadline_met);
+    add_to_bucket(start, execution, sample.deadline_met);
+  }
+  ++size_;
+  ++total_recorded_;
+}
+
+void SampleHistory::clear() noexcept {
+  head_ = 0;
+  size_ = 0;
+  evicted_count_ = 0;
+  total_recorded_ = 0;
+  bucket_head_ = 0;
+  bucket_size_ = 0;
+  tiers_.clear();
+  newest_start_ns_ = 0;
+}
+
+void SampleHistory::compact() noexcept { tiers_.compact(newest_start_ns_); }
+
+TimingSample SampleHistory::at(size_t index) const noexcept {
+  size_t physical = position(index);
+
+  TimingSample sample{};
+  sample.component = component_;
+  sample.start_time = from_ns(start_ns_[physical]);
+  sample.execution_time = std::chrono::nanoseconds(execution_ns_[physical]);
+  sample.end_time = sample.start_time + sample.execution_time;
+  sample.jitter = std::chrono::nanoseconds(jitter_ns_[physical]);
+  sample.deadline_met = deadline_met(index);
+  return sample;
+}
+
+uint64_t SampleHistory::deadline_misses(size_t first_index) const noexcept {
+  if (first_index >= size_) {
+    return 0;
+  }
+
+  size_t begin = position(first_index);
+  size_t count = size_ - first_index;
+  if (begin + count <= capacity_) {
+    return count_misses(begin, begin + count);
+  }
+  return count_misses(begin, capacity_) +
+         count_misses(0, begin + count - capacity_);
+}
+
+ColumnSlices<int64_t>
+SampleHistory::slices(const std::vector<int64_t> &column,
+                      size_t first_index) const noexcept {
+  ColumnSlices<int64_t> result;
+  if (first_index >= size_) {
+    return result;
+  }
+
+  size_t begin = position(first_index);
+  size_t count = size_ - first_index;
+  result.first = column.data() + begin;
+  result.first_size = std::min(count, capacity_ - begin);
+  if (result.first_size < count) {
+    result.second = column.data();
+    result.second_size = count - result.first_size;
+  }
+  return result;
+}
+
+uint64_t SampleHistory::count_misses(size_t begin, size_t end) const noexcept {
+  uint64_t misses = 0;
+  while (begin < end) {
+    size_t word = begin / 64;
+    size_t offset = begin % 64;
+    size_t bits = std::min<size_t>(64 - offset, end - begin);
+    uint64_t mask = (bits == 64) ? ~uint64_t{0}
+                                 : ((uint64_t{1} << bits) - 1) << offset;
+    misses += popcount(miss_bits_[word] & mask);
+    begin += bits;
+  }
+  return misses;
+}
+
+void SampleHistory::set_deadline_met(size_t physical, bool met) noexcept {
+  uint64_t bit = uint64_t{1} << (physical % 64);
+  if (met) {
+    miss_bits_[physical / 64] &= ~bit;
+  } else {
+    miss_bits_[physical / 64] |= bit;
+  }
+}
+
+void SampleHistory::evict_oldest() noexcept {
+  tiers_.add(start_ns_[head_], execution_ns_[head_], deadline_met(0));
+  head_ = (head_ + 1 == capacity_) ? 0 : head_ + 1;
+  --size_;
+  ++evicted_count_;
+
+  // Drop the oldest bucket once none of its samples are retained
+  if (bucket_size_ > 0 && bucket_end(0) <= oldest_sequence()) {
+    bucket_head_ = (bucket_head_ + 1) % buckets_.size();
+    --bucket_size_;
+  }
+}
+
+void SampleHistory::evict_late(int64_t start_ns, int64_t execution_ns,
+                               bool met) noexcept {
+  tiers_.add(start_ns, execution_ns, met);
+  ++evicted_count_;
+
+  // The sample takes the sequence number before the oldest retained one
+  ++total_recorded_;
+  for (size_t i = 0; i < bucket_size_; ++i) {
+    ++bucket(i).first_sequence;
+  }
+}
+
+void SampleHistory::insert_at(size_t index, int64_t start_ns,
+                              const TimingSample &sample) noexcept {
+  // Move the newer samples up by one; the ring has a free slot past them
+  for (size_t i = size_; i > index; --i) {
+    size_t target = position(i);
+    size_t source = position(i - 1);
+    execution_ns_[target] = execution_ns_[source];
+    start_ns_[target] = start_ns_[source];
+    jitter_ns_[target] = jitter_ns_[source];
+    set_deadline_met(target, deadline_met(i - 1));
+  }
+
+  size_t physical = position(index);
+  execution_ns_[physical] = sample.execution_time.count();
+  start_ns_[physical] = start_ns;
+  jitter_ns_[physical] = sample.jitter.count();
+  set_deadline_met(physical, sample.deadline_met);
+
+  // The bucket holding the position takes the sample; later buckets keep
+  // their samples, which now sit one sequence number further on
+  uint64_t sequence = oldest_sequence() + index;
+  size_t holder = bucket_size_ - 1;
+  while (holder > 0 && bucket(holder).first_sequence > sequence) {
+    ++bucket(holder).first_sequence;
+    --holder;
+  }
+  bucket(holder).stats.add(sample.execution_time.count(),
+                           sample.deadline_met);
+}
+
+void SampleHistory::add_to_bucket(int64_t start_ns, int64_t execution_ns,
+                                  bool met) {
+  int64_t key = start_ns / policy_.aggregate_interval.count();
+
+  // Samples arrive here in start order, but an earlier key can follow a
+  // policy change; it joins the newest bucket so buckets always cover
+  // consecutive sequence ranges
+  if (bucket_size_ == 0 || key > bucket(bucket_size_ - 1).key) {
+    if (bucket_size_ == buckets_.size()) {
+      std::vector<Bucket> grown(std::max<size_t>(buckets_.size() * 2, 16));
+      for (size_t i = 0; i < bucket_size_; ++i) {
+        grown[i] = bucket(i);
+      }
+      buckets_.swap(grown);
+      bucket_head_ = 0;
+    }
+
+    Bucket &created = bucket(bucket_size_);
+    created.key = key;
+    created.first_sequence = total_recorded_;
+    created.stats.clear();
+    ++bucket_size_;
+  }
+
+  bucket(bucket_size_ - 1).stats.add(execution_ns, met);
+}
+
+void SampleHistory::rebuild_buckets() {
+  bucket_head_ = 0;
+  bucket_size_ = 0;
+
+  // Re-append retained samples under their original sequence numbers
+  uint64_t recorded = total_recorded_;
+  total_recorded_ = oldest_sequence();
+  for (size_t i = 0; i < size_; ++i) {
+    add_to_bucket(start_ns(i), execution_ns(i), deadline_met(i));
+    ++total_recorded_;
+  }
+  total_recorded_ = recorded;
+}
+
+size_t SampleHistory::lower_bound(int64_t start_ns) const noexcept {
+  size_t low = 0;
+  size_t high = size_;
+  while (low < high) {
+    size_t middle = low + (high - low) / 2;
+    if (start_ns_[position(middle)] < start_ns) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+RunningStatistics SampleHistory::aggregate(size_t first_index) const noexcept {
+  RunningStatistics result;
+  if (first_index >= size_ || bucket_size_ == 0) {
+    return result;
+  }
+
+  // Find the bucket holding the first requested sample
+  uint64_t first_sequence = oldest_sequence() + first_index;
+  size_t low = 0;
+  size_t high = bucket_size_;
+  while (high - low > 1) {
+    size_t middle = low + (high - low) / 2;
+    if (bucket(middle).first_sequence <= first_sequence) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+
+  // Scan the partially covered boundary bucket, merge the rest
+  size_t next = low;
+  if (bucket(low).first_sequence != first_sequence) {
+    size_t end_index = static_cast<size_t>(bucket_end(low) - oldest_sequence());
+    for (size_t i = first_index; i < end_index; ++i) {
+      result.add(execution_ns(i), deadline_met(i));
+    }
+    ++next;
+  }
+  for (; next < bucket_size_; ++next) {
+    result.merge(bucket(next).stats);
+  }
+  return result;
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
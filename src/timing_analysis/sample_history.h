@@ -0,0 +1,280 @@
+/**
+ * @file sample_history.h
+ * @brief Bounded per-component measurement history for timing analysis
+ *
+ * Stores timing samples column-wise in preallocated ring buffers governed by
+ * a RetentionPolicy, so long-running measurement keeps a flat memory profile
+ * and analysis passes stream a single dense column.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include "history_tiers.h"
+#include "running_statistics.h"
+#include "timing_analyzer.h"
+#include <cstdint>
+#include <vector>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @brief Contiguous pieces of a ring column, oldest first
+ *
+ * A range of a ring buffer spans at most two contiguous runs of storage.
+ */
+template <typename T> struct ColumnSlices {
+  const T *first = nullptr;  ///< Oldest contiguous run
+  size_t first_size = 0;     ///< Elements in the first run
+  const T *second = nullptr; ///< Wrapped-around run, if any
+  size_t second_size = 0;    ///< Elements in the second run
+
+  /**
+   * @brief Visit every element in order
+   * @param visitor Callable taking const T&
+   */
+  template <typename Visitor> void for_each(Visitor &&visitor) const {
+    for (size_t i = 0; i < first_size; ++i) {
+      visitor(first[i]);
+    }
+    for (size_t i = 0; i < second_size; ++i) {
+      visitor(second[i]);
+    }
+  }
+};
+
+/**
+ * @class SampleHistory
+ * @brief Fixed-capacity columnar ring of timing samples with age window
+ *
+ * When the ring is full, or when the oldest sample falls outside the
+ * configured age window relative to the newest one, the oldest samples are
+ * evicted and counted.
+ *
+ * Execution times, start times and jitter are kept in separate int64
+ * nanosecond columns and deadline misses in a bitset; end times are derived
+ * as start + execution time. TimingSample records are materialized only on
+ * request through at().
+ *
+ * Samples are kept in start-time order, which makes the start-time column
+ * a time index. They are expected to arrive approximately in that order; a
+ * sample starting before retained ones is inserted at its position, at a
+ * cost that grows with the number of newer samples it passes. Consecutive
+ * samples are also grouped into buckets of policy().aggregate_interval with
+ * pre-computed aggregates, so time-windowed aggregates cost O(log n) plus
+ * the buckets and the one partial bucket at the window boundary.
+ *
+ * When the policy enables downsampling, evicted samples are folded into
+ * HistoryTiers instead of being dropped; compact() rolls the tiers up.
+ *
+ * Thread Safety: not thread-safe; callers provide external locking.
+ */
+class SampleHistory {
+public:
+  /**
+   * @brief Construct a history and preallocate its storage
+   * @param component Component the samples belong to
+   * @param policy Retention policy to apply
+   */
+  explicit SampleHistory(ComponentId component = INVALID_COMPONENT_ID,
+                         const RetentionPolicy &policy = RetentionPolicy{});
+
+  /**
+   * @brief Change the retention policy, keeping the newest samples
+   * @param policy New retention policy
+   */
+  void set_policy(const RetentionPolicy &policy);
+
+  /**
+   * @brief Current retention policy
+   * @return Retention policy in effect
+   */
+  const RetentionPolicy &policy() const noexcept { return policy_; }
+
+  /**
+   * @brief Append a sample, evicting old samples as required by the policy
+   * @param sample Sample to append
+   *
+   * Column storage is preallocated; the bucket ring grows geometrically
+   * until it covers the retained time span. A sample older than every
+   * retained one when the ring is full, or older than max_age relative to
+   * the newest sample, is evicted right away.
+   */
+  void append(const TimingSample &sample);
+
+  /**
+   * @brief Discard all retained samples and aggregates and reset counters
+   */
+  void clear() noexcept;
+
+  /**
+   * @brief Roll up and expire downsampled aggregates past their tier's age
+   *
+   * Ages are measured against the newest sample appended.
+   */
+  void compact() noexcept;
+
+  /**
+   * @brief Downsampled aggregates of evicted samples
+   */
+  const HistoryTiers &tiers() const noexcept { return tiers_; }
+
+  /**
+   * @brief Number of retained samples
+   */
+  size_t size() const noexcept { return size_; }
+
+  /**
+   * @brief Whether no samples are retained
+   */
+  bool empty() const noexcept { return size_ == 0; }
+
+  /**
+   * @brief Preallocated capacity in samples
+   */
+  size_t capacity() const noexcept { return capacity_; }
+
+  /**
+   * @brief Materialize a retained sample
+   * @param index Position from the oldest retained sample (0)
+   * @return Sample at the given position
+   */
+  TimingSample at(size_t index) const noexcept;
+
+  /**
+   * @brief Execution time of a retained sample in nanoseconds
+   */
+  int64_t execution_ns(size_t index) const noexcept {
+    return execution_ns_[position(index)];
+  }
+
+  /**
+   * @brief Start time of a retained sample in steady_clock nanoseconds
+   */
+  int64_t start_ns(size_t index) const noexcept {
+    return start_ns_[position(index)];
+  }
+
+  /**
+   * @brief Whether a retained sample met its deadline
+   */
+  bool deadline_met(size_t index) const noexcept {
+    size_t bit = position(index);
+    return (miss_bits_[bit / 64] & (uint64_t{1} << (bit % 64))) == 0;
+  }
+
+  /**
+   * @brief Execution-time column from a position to the newest sample
+   * @param first_index Position from the oldest retained sample
+   */
+  ColumnSlices<int64_t> execution_times(size_t first_index) const noexcept {
+    return slices(execution_ns_, first_index);
+  }
+
+  /**
+   * @brief Start-time column from a position to the newest sample
+   * @param first_index Position from the oldest retained sample
+   */
+  ColumnSlices<int64_t> start_times(size_t first_index) const noexcept {
+    return slices(start_ns_, first_index);
+  }
+
+  /**
+   * @brief Position of the first sample that started at or after a time
+   * @param start_ns Start time in steady_clock nanoseconds
+   * @return Position in [0, size()], found by binary search
+   */
+  size_t lower_bound(int64_t start_ns) const noexcept;
+
+  /**
+   * @brief Aggregates from a position to the newest sample
+   * @param first_index Position from the oldest retained sample
+   * @return Count, mean, deviation, extrema and misses of the range,
+   *         merged from bucket pre-aggregates where buckets are covered
+   */
+  RunningStatistics aggregate(size_t first_index) const noexcept;
+
+  /**
+   * @brief Number of pre-aggregated buckets covering the retained samples
+   */
+  size_t bucket_count() const noexcept { return bucket_size_; }
+
+  /**
+   * @brief Deadline misses from a position to the newest sample
+   * @param first_index Position from the oldest retained sample
+   * @return Number of misses, counted a word of the bitset at a time
+   */
+  uint64_t deadline_misses(size_t first_index) const noexcept;
+
+  /**
+   * @brief Number of samples evicted by the retention policy, downsampled
+   *        ones included
+   */
+  uint64_t evicted_count() const noexcept { return evicted_count_; }
+
+  /**
+   * @brief Number of samples appended since the last clear
+   */
+  uint64_t total_recorded() const noexcept { return total_recorded_; }
+
+private:
+  /// Pre-aggregates for a run of consecutive samples
+  struct Bucket {
+    int64_t key = 0;             ///< start_ns / aggregate_interval of the run
+    uint64_t first_sequence = 0; ///< Sequence number of the first sample
+    RunningStatistics stats;     ///< Includes samples since evicted
+  };
+
+  size_t position(size_t index) const noexcept {
+    size_t physical = head_ + index;
+    return (physical >= capacity_) ? physical - capacity_ : physical;
+  }
+
+  ColumnSlices<int64_t> slices(const std::vector<int64_t> &column,
+                               size_t first_index) const noexcept;
+  uint64_t count_misses(size_t begin, size_t end) const noexcept;
+  void set_deadline_met(size_t physical, bool met) noexcept;
+  void evict_oldest() noexcept;
+  void evict_late(int64_t start_ns, int64_t execution_ns, bool met) noexcept;
+  void insert_at(size_t index, int64_t start_ns,
+                 const TimingSample &sample) noexcept;
+  void add_to_bucket(int64_t start_ns, int64_t execution_ns, bool met);
+  void rebuild_buckets();
+  Bucket &bucket(size_t index) noexcept {
+    return buckets_[(bucket_head_ + index) % buckets_.size()];
+  }
+  const Bucket &bucket(size_t index) const noexcept {
+    return buckets_[(bucket_head_ + index) % buckets_.size()];
+  }
+  uint64_t oldest_sequence() const noexcept { return total_recorded_ - size_; }
+  uint64_t bucket_end(size_t index) const noexcept {
+    return (index + 1 < bucket_size_) ? bucket(index + 1).first_sequence
+                                      : total_recorded_;
+  }
+
+  ComponentId component_;
+  RetentionPolicy policy_;
+  size_t capacity_ = 0;
+  std::vector<int64_t> execution_ns_;
+  std::vector<int64_t> start_ns_;
+  std::vector<int64_t> jitter_ns_;
+  std::vector<uint64_t> miss_bits_; ///< Bit set when the deadline was missed
+  size_t head_ = 0; ///< Physical index of the oldest retained sample
+  size_t size_ = 0;
+  uint64_t evicted_count_ = 0;
+  uint64_t total_recorded_ = 0;
+
+  std::vector<Bucket> buckets_; ///< Ring of buckets, oldest first
+  size_t bucket_head_ = 0;
+  size_t bucket_size_ = 0;
+
+  HistoryTiers tiers_;
+  int64_t newest_start_ns_ = 0; ///< Start of the newest sample appended
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,233 @@
+/**
+ * @file sampling_engine.cpp
+ * @brief Timer-driven periodic tick thread implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "sampling_engine.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <system_error>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+constexpr int64_t kNanosecondsPerSecond = 1000000000;
+
+bool valid_rate(double sample_rate) noexcept {
+  return sample_rate > 0.0 && sample_rate <= SamplingEngine::kMaxSampleRate;
+}
+
+int64_t period_for(double sample_rate) noexcept {
+  return std::max<int64_t>(
+      1, static_cast<int64_t>(std::llround(1.0e9 / sample_rate)));
+}
+
+#ifdef __linux__
+int64_t monotonic_ns() noexcept {
+  timespec now{};
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return static_cast<int64_t>(now.tv_sec) * kNanosecondsPerSecond +
+         now.tv_nsec;
+}
+
+timespec to_timespec(int64_t ns) noexcept {
+  timespec value{};
+  value.tv_sec = static_cast<time_t>(ns / kNanosecondsPerSecond);
+  value.tv_nsec = static_cast<long>(ns % kNanosecondsPerSecond);
+  return value;
+}
+#endif
+
+} // anonymous namespace
+
+bool SamplingEngine::start(double sample_rate, std::function<void()> tick,
+                           std::function<void()> thread_setup) {
+#ifdef __linux__
+  if (running() || !valid_rate(sample_rate) || !tick) {
+    return false;
+  }
+
+  timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+  stop_fd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (timer_fd_ < 0 || stop_fd_ < 0) {
+    stop();
+    return false;
+  }
+
+  tick_ = std::move(tick);
+  thread_setup_ = std::move(thread_setup);
+  period_ns_.store(period_for(sample_rate));
+  rate_changed_.store(false);
+  {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    sample_rate_ = sample_rate;
+    ticks_ = 0;
+    missed_ticks_ = 0;
+    max_tick_ns_ = 0;
+    latency_sum_ns_ = 0;
+    wakeup_latency_.clear();
+  }
+
+  try {
+    thread_ = std::thread(&SamplingEngine::run, this);
+  } catch (const std::system_error &) {
+    stop();
+    return false;
+  }
+  return true;
+#else
+  (void)sample_rate;
+  (void)tick;
+  (void)thread_setup;
+  return false;
+#endif
+}
+
+void SamplingEngine::stop() noexcept {
+#ifdef __linux__
+  if (thread_.joinable()) {
+    uint64_t one = 1;
+    ssize_t written = write(stop_fd_, &one, sizeof(one));
+    (void)written;
+    thread_.join();
+  }
+  if (timer_fd_ >= 0) {
+    close(timer_fd_);
+    timer_fd_ = -1;
+  }
+  if (stop_fd_ >= 0) {
+    close(stop_fd_);
+    stop_fd_ = -1;
+  }
+#endif
+}
+
+bool SamplingEngine::set_rate(double sample_rate) noexcept {
+  if (!valid_rate(sample_rate)) {
+    return false;
+  }
+
+  period_ns_.store(period_for(sample_rate));
+  rate_changed_.store(true);
+  std::lock_guard<std::mutex> lock(statistics_mutex_);
+  sample_rate_ = sample_rate;
+  return true;
+}
+
+SamplingStatistics SamplingEngine::statistics() const {
+  SamplingStatistics statistics;
+  statistics.running = running();
+
+  std::lock_guard<std::mutex> lock(statistics_mutex_);
+  statistics.sample_rate = sample_rate_;
+  statistics.ticks = ticks_;
+  statistics.missed_ticks = missed_ticks_;
+  statistics.max_tick_duration = std::chrono::nanoseconds(max_tick_ns_);
+  if (ticks_ > 0) {
+    statistics.mean_wakeup_latency = std::chrono::nanoseconds(
+        static_cast<int64_t>(latency_sum_ns_ / ticks_));
+    statistics.p99_wakeup_latency =
+        wakeup_latency_.values_at_percentiles({0.99})[0];
+    statistics.max_wakeup_latency = wakeup_latency_.max_value();
+  }
+  return statistics;
+}
+
+bool SamplingEngine::arm_timer(int64_t period_ns,
+                               int64_t &first_deadline_ns) noexcept {
+#ifdef __linux__
+  first_deadline_ns = monotonic_ns() + period_ns;
+  itimerspec spec{};
+  spec.it_value = to_timespec(first_deadline_ns);
+  spec.it_interval = to_timespec(period_ns);
+  return timerfd_settime(timer_fd_, TFD_TIMER_ABSTIME, &spec, nullptr) == 0;
+#else
+  (void)period_ns;
+  (void)first_deadline_ns;
+  return false;
+#endif
+}
+
+void SamplingEngine::run() noexcept {
+#ifdef __linux__
+  if (thread_setup_) {
+    try {
+      thread_setup_();
+    } catch (...) {
+      // Setup only tunes the thread; sampling runs regardless
+    }
+  }
+
+  int64_t period_ns = period_ns_.load();
+  int64_t deadline_ns = 0;
+  if (!arm_timer(period_ns, deadline_ns)) {
+    return;
+  }
+
+  pollfd fds[2] = {{timer_fd_, POLLIN, 0}, {stop_fd_, POLLIN, 0}};
+  while (true) {
+    if (poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+    if ((fds[1].revents & POLLIN) != 0) {
+      return;
+    }
+
+    uint64_t expirations = 0;
+    if (read(timer_fd_, &expirations, sizeof(expirations)) !=
+            static_cast<ssize_t>(sizeof(expirations)) ||
+        expirations == 0) {
+      continue;
+    }
+
+    // Run once for the latest expiration; earlier ones were missed
+    deadline_ns += static_cast<int64_t>(expirations - 1) * period_ns;
+    int64_t wakeup_ns = monotonic_ns();
+    try {
+      tick_();
+    } catch (...) {
+      // A failing probe pass must not stop the schedule
+    }
+    int64_t tick_ns = monotonic_ns() - wakeup_ns;
+    int64_t latency_ns = std::max<int64_t>(0, wakeup_ns - deadline_ns);
+
+    {
+      std::lock_guard<std::mutex> lock(statistics_mutex_);
+      ++ticks_;
+      missed_ticks_ += expirations - 1;
+      max_tick_ns_ = std::max(max_tick_ns_, tick_ns);
+      latency_sum_ns_ += static_cast<uint64_t>(latency_ns);
+      wakeup_latency_.record(std::chrono::nanoseconds(latency_ns));
+    }
+
+    deadline_ns += period_ns;
+    if (rate_changed_.exchange(false)) {
+      period_ns = period_ns_.load();
+      if (!arm_timer(period_ns, deadline_ns)) {
+        return;
+      }
+    }
+  }
+#endif
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
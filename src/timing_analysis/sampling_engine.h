@@ -0,0 +1,103 @@
+/**
+ * @file sampling_engine.h
+ * @brief Timer-driven periodic tick thread for probe sampling
+ *
+ * Runs a tick function at a fixed rate on a dedicated thread. Ticks are
+ * driven by a periodic timerfd armed with an absolute CLOCK_MONOTONIC
+ * start time, so the kernel keeps the schedule and rounding errors never
+ * accumulate into drift. Expirations that pass while a tick overruns are
+ * counted as missed ticks and skipped rather than replayed in a burst.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include "latency_histogram.h"
+#include "timing_analyzer.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @class SamplingEngine
+ * @brief Periodic tick thread with wakeup jitter accounting
+ *
+ * Thread Safety: start() and stop() must be serialized by the owner;
+ * set_rate() and statistics() may be called concurrently with them. The
+ * tick function runs on the engine thread.
+ */
+class SamplingEngine {
+public:
+  /// Highest supported tick rate in Hz
+  static constexpr double kMaxSampleRate = 100000.0;
+
+  SamplingEngine() = default;
+  ~SamplingEngine() { stop(); }
+  SamplingEngine(const SamplingEngine &) = delete;
+  SamplingEngine &operator=(const SamplingEngine &) = delete;
+
+  /**
+   * @brief Start ticking
+   * @param sample_rate Ticks per second, at most kMaxSampleRate
+   * @param tick Called once per tick on the engine thread
+   * @param thread_setup Called once on the engine thread before the first
+   *        tick, e.g. to apply scheduling settings
+   * @return false if already running, the rate is invalid or the timer or
+   *         thread cannot be created
+   */
+  bool start(double sample_rate, std::function<void()> tick,
+             std::function<void()> thread_setup = nullptr);
+
+  /**
+   * @brief Stop ticking and join the engine thread
+   */
+  void stop() noexcept;
+
+  /**
+   * @brief Whether the engine thread is running
+   */
+  bool running() const noexcept { return thread_.joinable(); }
+
+  /**
+   * @brief Change the tick rate; the schedule restarts from the next tick
+   * @return false if the rate is invalid
+   */
+  bool set_rate(double sample_rate) noexcept;
+
+  /**
+   * @brief Tick and jitter counters since start()
+   */
+  SamplingStatistics statistics() const;
+
+private:
+  void run() noexcept;
+  bool arm_timer(int64_t period_ns, int64_t &first_deadline_ns) noexcept;
+
+  std::thread thread_;
+  int timer_fd_ = -1;
+  int stop_fd_ = -1; ///< eventfd that wakes the engine thread to stop
+  std::function<void()> tick_;
+  std::function<void()> thread_setup_;
+  std::atomic<int64_t> period_ns_{0};
+  std::atomic<bool> rate_changed_{false};
+
+  mutable std::mutex statistics_mutex_;
+  double sample_rate_ = 0.0;     ///< Guarded by statistics_mutex_
+  uint64_t ticks_ = 0;           ///< Guarded by statistics_mutex_
+  uint64_t missed_ticks_ = 0;    ///< Guarded by statistics_mutex_
+  int64_t max_tick_ns_ = 0;      ///< Guarded by statistics_mutex_
+  uint64_t latency_sum_ns_ = 0;  ///< Guarded by statistics_mutex_
+  LatencyHistogram wakeup_latency_; ///< Guarded by statistics_mutex_
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
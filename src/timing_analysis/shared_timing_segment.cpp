@@ -0,0 +1,476 @@
+/**
+ * @file shared_timing_segment.cpp
+ * @brief POSIX shared-memory timing transport implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "shared_timing_segment.h"
+#include "lock_free_ring.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+constexpr char kSegmentMagic[8] = {'I', 'V', 'V', 'S', 'H', 'M', 'E', 'M'};
+constexpr uint32_t kSegmentVersion = 1;
+constexpr size_t kHeaderSize = 4096;
+constexpr size_t kMaxNameLength = 255;
+constexpr size_t kMaxLabelLength = 63;
+
+struct SegmentHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t producer_capacity;
+  uint32_t ring_capacity;
+  uint32_t dictionary_capacity;
+  uint64_t slot_size;
+  uint64_t dictionary_offset; ///< Within a slot
+  uint64_t records_offset;    ///< Within a slot
+  std::atomic<uint32_t> open; ///< Cleared when the collector closes
+  std::atomic<int64_t> collector_heartbeat_ns;
+};
+
+/// Head of a producer slot; identity fields are written while the slot is
+/// claimed and published by the store of the active state
+struct SlotHeader {
+  std::atomic<uint32_t> state;
+  std::atomic<uint32_t> generation;
+  int32_t pid;
+  char label[kMaxLabelLength + 1];
+  std::atomic<int64_t> heartbeat_ns;
+  std::atomic<int64_t> clock_offset_ns;
+  std::atomic<uint64_t> dropped;
+  alignas(kCacheLineSize) std::atomic<uint64_t> tail; ///< Producer position
+  alignas(kCacheLineSize) std::atomic<uint64_t> head; ///< Collector position
+};
+
+/// Dictionary slot; id is index + 1 once the name is published
+struct SharedDictionaryEntry {
+  std::atomic<uint32_t> id;
+  uint32_t length;
+  char name[kMaxNameLength + 1];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<int64_t>::is_always_lock_free &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+              "Shared memory atomics must be address-free");
+
+using SlotState = SharedTimingCollector::SlotState;
+
+constexpr uint32_t state_value(SlotState state) noexcept {
+  return static_cast<uint32_t>(state);
+}
+
+size_t page_size() noexcept {
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+size_t round_up(size_t value, size_t multiple) noexcept {
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+int64_t steady_ns() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+SegmentHeader *segment_header(void *mapping) noexcept {
+  return static_cast<SegmentHeader *>(mapping);
+}
+
+SlotHeader *slot_header(void *mapping, uint32_t slot) noexcept {
+  const SegmentHeader *header = segment_header(mapping);
+  return reinterpret_cast<SlotHeader *>(static_cast<char *>(mapping) +
+                                        kHeaderSize +
+                                        slot * header->slot_size);
+}
+
+SharedDictionaryEntry *dictionary(const SegmentHeader *header,
+                                  void *slot) noexcept {
+  return reinterpret_cast<SharedDictionaryEntry *>(static_cast<char *>(slot) +
+                                                   header->dictionary_offset);
+}
+
+TraceRecord *ring_records(const SegmentHeader *header, void *slot) noexcept {
+  return reinterpret_cast<TraceRecord *>(static_cast<char *>(slot) +
+                                         header->records_offset);
+}
+
+} // anonymous namespace
+
+int64_t steady_to_realtime_offset_ns() noexcept {
+  // The steady reads bracket the realtime read; the narrowest bracket
+  // pins the pair closest together
+  int64_t best_offset = 0;
+  int64_t best_gap = std::numeric_limits<int64_t>::max();
+  for (int attempt = 0; attempt < 3; ++attempt) {
+    int64_t before = steady_ns();
+    int64_t realtime = realtime_ns();
+    int64_t after = steady_ns();
+    if (after - before < best_gap) {
+      best_gap = after - before;
+      best_offset = realtime - (before + best_gap / 2);
+    }
+  }
+  return best_offset;
+}
+
+int64_t realtime_ns() noexcept {
+  timespec now{};
+  clock_gettime(CLOCK_REALTIME, &now);
+  return int64_t{now.tv_sec} * 1000000000 + now.tv_nsec;
+}
+
+bool process_exited(int pid) noexcept {
+  return pid > 0 && kill(pid, 0) != 0 && errno == ESRCH;
+}
+
+// SharedTimingProducer
+
+bool SharedTimingProducer::attach(const std::string &segment_name,
+                                  const std::string &label) {
+  detach();
+
+  int fd = shm_open(segment_name.c_str(), O_RDWR | O_CLOEXEC, 0);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat info{};
+  void *mapping = MAP_FAILED;
+  size_t size = 0;
+  if (fstat(fd, &info) == 0 &&
+      info.st_size >= static_cast<off_t>(kHeaderSize)) {
+    size = static_cast<size_t>(info.st_size);
+    mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+
+  const SegmentHeader *header = segment_header(mapping);
+  bool valid =
+      std::memcmp(header->magic, kSegmentMagic, sizeof(kSegmentMagic)) == 0 &&
+      header->version == kSegmentVersion &&
+      header->dictionary_capacity == kSharedDictionaryCapacity &&
+      header->ring_capacity != 0 &&
+      kHeaderSize + header->slot_size * header->producer_capacity <= size &&
+      header->open.load(std::memory_order_acquire) != 0;
+  if (!valid) {
+    munmap(mapping, size);
+    return false;
+  }
+
+  for (uint32_t slot = 0; slot < header->producer_capacity; ++slot) {
+    SlotHeader *candidate = slot_header(mapping, slot);
+    uint32_t expected = state_value(SlotState::FREE);
+    if (!candidate->state.compare_exchange_strong(
+            expected, state_value(SlotState::CLAIMED),
+            std::memory_order_acq_rel)) {
+      continue;
+    }
+
+    // The collector ignores claimed slots, so the reset cannot race it
+    candidate->pid = static_cast<int32_t>(getpid());
+    size_t length = std::min(label.size(), kMaxLabelLength);
+    std::memcpy(candidate->label, label.data(), length);
+    candidate->label[length] = '\0';
+    candidate->dropped.store(0, std::memory_order_relaxed);
+    candidate->head.store(0, std::memory_order_relaxed);
+    candidate->tail.store(0, std::memory_order_relaxed);
+    SharedDictionaryEntry *entries = dictionary(header, candidate);
+    for (uint32_t i = 0; i < kSharedDictionaryCapacity; ++i) {
+      entries[i].id.store(0, std::memory_order_relaxed);
+    }
+
+    mapping_ = mapping;
+    mapping_size_ = size;
+    slot_ = candidate;
+    head_cache_ = 0;
+    generation_ = candidate->generation.load(std::memory_order_relaxed) + 1;
+    candidate->generation.store(generation_, std::memory_order_relaxed);
+    heartbeat();
+    candidate->state.store(state_value(SlotState::ACTIVE),
+                           std::memory_order_release);
+    return true;
+  }
+
+  munmap(mapping, size);
+  return false;
+}
+
+void SharedTimingProducer::detach() noexcept {
+  if (slot_ == nullptr) {
+    return;
+  }
+
+  // A slot the collector has reclaimed may already belong to another
+  // producer and is left alone
+  auto *slot = static_cast<SlotHeader *>(slot_);
+  if (owns_slot()) {
+    uint32_t expected = state_value(SlotState::ACTIVE);
+    slot->state.compare_exchange_strong(expected,
+                                        state_value(SlotState::DETACHED),
+                                        std::memory_order_acq_rel);
+  }
+
+  munmap(mapping_, mapping_size_);
+  mapping_ = nullptr;
+  mapping_size_ = 0;
+  slot_ = nullptr;
+}
+
+bool SharedTimingProducer::is_connected(
+    std::chrono::nanoseconds timeout) const noexcept {
+  if (slot_ == nullptr) {
+    return false;
+  }
+
+  const SegmentHeader *header = segment_header(mapping_);
+  const auto *slot = static_cast<const SlotHeader *>(slot_);
+  int64_t collector_age =
+      realtime_ns() -
+      header->collector_heartbeat_ns.load(std::memory_order_relaxed);
+  return header->open.load(std::memory_order_acquire) != 0 &&
+         collector_age <= timeout.count() && owns_slot() &&
+         slot->state.load(std::memory_order_acquire) ==
+             state_value(SlotState::ACTIVE);
+}
+
+bool SharedTimingProducer::define_component(uint32_t index,
+                                            const std::string &name) noexcept {
+  if (slot_ == nullptr || index >= kSharedDictionaryCapacity ||
+      name.size() > kMaxNameLength || !owns_slot()) {
+    return false;
+  }
+
+  SharedDictionaryEntry &entry =
+      dictionary(segment_header(mapping_), slot_)[index];
+  entry.length = static_cast<uint32_t>(name.size());
+  std::memcpy(entry.name, name.data(), name.size());
+  entry.name[name.size()] = '\0';
+  entry.id.store(index + 1, std::memory_order_release);
+  return true;
+}
+
+bool SharedTimingProducer::append(const TraceRecord &record) noexcept {
+  // A stalled producer whose slot was reclaimed must not write into the
+  // ring of the slot's new owner, nor count drops against it
+  if (slot_ == nullptr || !owns_slot()) {
+    return false;
+  }
+
+  const SegmentHeader *header = segment_header(mapping_);
+  auto *slot = static_cast<SlotHeader *>(slot_);
+  uint64_t tail = slot->tail.load(std::memory_order_relaxed);
+  if (tail - head_cache_ >= header->ring_capacity) {
+    head_cache_ = slot->head.load(std::memory_order_acquire);
+    if (tail - head_cache_ >= header->ring_capacity) {
+      slot->dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  }
+
+  ring_records(header, slot)[tail & (header->ring_capacity - 1)] = record;
+  if (!owns_slot()) {
+    return false; // Reclaimed while writing; leave the new owner's tail
+  }
+  slot->tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+bool SharedTimingProducer::owns_slot() const noexcept {
+  // release() bumps the generation before the slot is freed
+  const auto *slot = static_cast<const SlotHeader *>(slot_);
+  return slot->generation.load(std::memory_order_acquire) == generation_;
+}
+
+void SharedTimingProducer::heartbeat() noexcept {
+  if (slot_ == nullptr || !owns_slot()) {
+    return;
+  }
+
+  auto *slot = static_cast<SlotHeader *>(slot_);
+  slot->clock_offset_ns.store(steady_to_realtime_offset_ns(),
+                              std::memory_order_relaxed);
+  slot->heartbeat_ns.store(realtime_ns(), std::memory_order_release);
+}
+
+// SharedTimingCollector
+
+bool SharedTimingCollector::create(const std::string &segment_name,
+                                   uint32_t producer_capacity,
+                                   uint32_t ring_capacity) {
+  close();
+  if (producer_capacity == 0 || ring_capacity == 0 ||
+      ring_capacity > (uint32_t{1} << 30)) {
+    return false;
+  }
+
+  uint32_t rounded = 1;
+  while (rounded < ring_capacity) {
+    rounded <<= 1;
+  }
+
+  size_t dictionary_offset = round_up(sizeof(SlotHeader), kCacheLineSize);
+  size_t records_offset = round_up(
+      dictionary_offset +
+          sizeof(SharedDictionaryEntry) * kSharedDictionaryCapacity,
+      kCacheLineSize);
+  size_t slot_size =
+      round_up(records_offset + sizeof(TraceRecord) * rounded, page_size());
+  size_t size = kHeaderSize + slot_size * producer_capacity;
+
+  // A segment left behind by a collector that crashed is replaced; the
+  // producers still mapping it see its heartbeat stop and attach again
+  shm_unlink(segment_name.c_str());
+  int fd = shm_open(segment_name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC,
+                    0600);
+  if (fd < 0) {
+    return false;
+  }
+
+  void *mapping = MAP_FAILED;
+  if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+    mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    shm_unlink(segment_name.c_str());
+    return false;
+  }
+
+  // The new segment reads as zeros: every slot is free and every
+  // dictionary entry unpublished
+  auto *header = new (mapping) SegmentHeader{};
+  std::memcpy(header->magic, kSegmentMagic, sizeof(kSegmentMagic));
+  header->version = kSegmentVersion;
+  header->producer_capacity = producer_capacity;
+  header->ring_capacity = rounded;
+  header->dictionary_capacity = kSharedDictionaryCapacity;
+  header->slot_size = slot_size;
+  header->dictionary_offset = dictionary_offset;
+  header->records_offset = records_offset;
+  for (uint32_t slot = 0; slot < producer_capacity; ++slot) {
+    void *memory = slot_header(mapping, slot);
+    new (memory) SlotHeader{};
+    auto *entries = reinterpret_cast<SharedDictionaryEntry *>(
+        static_cast<char *>(memory) + dictionary_offset);
+    for (uint32_t i = 0; i < kSharedDictionaryCapacity; ++i) {
+      new (&entries[i]) SharedDictionaryEntry{};
+    }
+  }
+
+  name_ = segment_name;
+  mapping_ = mapping;
+  mapping_size_ = size;
+  producer_capacity_ = producer_capacity;
+  ring_mask_ = rounded - 1;
+  heartbeat();
+  header->open.store(1, std::memory_order_release);
+  return true;
+}
+
+void SharedTimingCollector::close() noexcept {
+  if (mapping_ == nullptr) {
+    return;
+  }
+
+  segment_header(mapping_)->open.store(0, std::memory_order_release);
+  munmap(mapping_, mapping_size_);
+  shm_unlink(name_.c_str());
+  mapping_ = nullptr;
+  mapping_size_ = 0;
+  producer_capacity_ = 0;
+  name_.clear();
+}
+
+void SharedTimingCollector::heartbeat() noexcept {
+  segment_header(mapping_)->collector_heartbeat_ns.store(
+      realtime_ns(), std::memory_order_relaxed);
+}
+
+SharedTimingCollector::ProducerInfo
+SharedTimingCollector::producer(uint32_t slot) const {
+  const SlotHeader *header = slot_header(mapping_, slot);
+  ProducerInfo info;
+  info.state =
+      static_cast<SlotState>(header->state.load(std::memory_order_acquire));
+  if (info.state != SlotState::ACTIVE && info.state != SlotState::DETACHED) {
+    return info;
+  }
+
+  info.generation = header->generation.load(std::memory_order_relaxed);
+  info.pid = header->pid;
+  info.label.assign(header->label,
+                    strnlen(header->label, sizeof(header->label)));
+  info.heartbeat_ns = header->heartbeat_ns.load(std::memory_order_acquire);
+  info.clock_offset_ns =
+      header->clock_offset_ns.load(std::memory_order_relaxed);
+  info.dropped = header->dropped.load(std::memory_order_relaxed);
+  return info;
+}
+
+uint64_t SharedTimingCollector::tail(uint32_t slot) const noexcept {
+  return slot_header(mapping_, slot)->tail.load(std::memory_order_acquire);
+}
+
+void SharedTimingCollector::read_components(
+    uint32_t slot, uint32_t &next_index,
+    std::vector<Component> &components) const {
+  const SharedDictionaryEntry *entries =
+      dictionary(segment_header(mapping_), slot_header(mapping_, slot));
+  for (; next_index < kSharedDictionaryCapacity; ++next_index) {
+    const SharedDictionaryEntry &entry = entries[next_index];
+    if (entry.id.load(std::memory_order_acquire) != next_index + 1) {
+      break;
+    }
+    components.push_back(
+        Component{next_index, std::string(entry.name,
+                                          std::min<size_t>(entry.length,
+                                                           kMaxNameLength))});
+  }
+}
+
+void SharedTimingCollector::release(uint32_t slot) noexcept {
+  // Bumping the generation first tells a stalled producer the slot is gone
+  SlotHeader *header = slot_header(mapping_, slot);
+  header->generation.fetch_add(1, std::memory_order_acq_rel);
+  header->state.store(state_value(SlotState::FREE), std::memory_order_release);
+}
+
+const TraceRecord *
+SharedTimingCollector::records(uint32_t slot) const noexcept {
+  return ring_records(segment_header(mapping_), slot_header(mapping_, slot));
+}
+
+uint64_t SharedTimingCollector::load_head(uint32_t slot) const noexcept {
+  return slot_header(mapping_, slot)->head.load(std::memory_order_relaxed);
+}
+
+void SharedTimingCollector::store_head(uint32_t slot, uint64_t head) noexcept {
+  slot_header(mapping_, slot)->head.store(head, std::memory_order_release);
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
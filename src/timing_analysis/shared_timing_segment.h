@@ -0,0 +1,277 @@
+/**
+ * @file shared_timing_segment.h
+ * @brief POSIX shared-memory transport of timing records between processes
+ *
+ * One collector process creates a named segment holding a fixed number of
+ * producer slots. Each producer process claims a slot and owns its
+ * single-producer/single-consumer ring of TraceRecords and its component
+ * dictionary; the collector drains every ring. Nothing on either side
+ * takes a lock or makes a system call per record.
+ *
+ * Layout (native byte order):
+ *   [segment header, 4 KiB]
+ *   [producer slot] x producer_capacity, each a whole number of pages
+ *     [slot header][dictionary][record ring]
+ *
+ * Producers are usually in other clock domains: the steady clock of a
+ * process in another time namespace, or a TSC calibrated independently,
+ * has a different zero. Each side therefore publishes the offset from its
+ * steady clock to CLOCK_REALTIME, which all processes share, and the
+ * collector shifts record start times by the difference.
+ *
+ * Slot life cycle: a producer moves its slot from free to claimed while it
+ * resets it, then to active, and to detached when it leaves cleanly. Only
+ * the collector returns slots to free, after draining them, so a ring is
+ * never reused while it still holds records. A producer whose process is
+ * gone, or whose heartbeat is older than the timeout, is treated as dead.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include "trace_file.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/// Components one producer can name
+constexpr uint32_t kSharedDictionaryCapacity = 1024;
+
+/**
+ * @brief Offset from the steady clock to CLOCK_REALTIME in nanoseconds
+ *
+ * Read with the narrowest of a few bracketing steady clock reads, so the
+ * error is a fraction of one clock read.
+ */
+int64_t steady_to_realtime_offset_ns() noexcept;
+
+/**
+ * @brief Current CLOCK_REALTIME in nanoseconds
+ */
+int64_t realtime_ns() noexcept;
+
+/**
+ * @brief Whether no process with this pid exists in our pid namespace
+ *
+ * Producers in another pid namespace are only detected through their
+ * heartbeat.
+ */
+bool process_exited(int pid) noexcept;
+
+/**
+ * @class SharedTimingProducer
+ * @brief Writer side of one producer slot
+ *
+ * TraceRecord::component holds a dictionary index plus one, so that 0 stays
+ * INVALID_COMPONENT_ID; start_ns is in the producer's steady clock.
+ *
+ * Thread Safety: not thread-safe; callers provide external locking.
+ */
+class SharedTimingProducer {
+public:
+  SharedTimingProducer() = default;
+  ~SharedTimingProducer() { detach(); }
+  SharedTimingProducer(const SharedTimingProducer &) = delete;
+  SharedTimingProducer &operator=(const SharedTimingProducer &) = delete;
+
+  /**
+   * @brief Map a collector's segment and claim a free slot
+   * @param segment_name POSIX shared memory name, e.g. "/ivv_timing"
+   * @param label Process label shown by the collector, truncated to 63
+   *        bytes
+   * @return false if the segment does not exist, is not a timing segment,
+   *         its collector has stopped, or every slot is taken
+   */
+  bool attach(const std::string &segment_name, const std::string &label);
+
+  /**
+   * @brief Hand the slot back to the collector and unmap the segment
+   *
+   * Records already queued are still collected.
+   */
+  void detach() noexcept;
+
+  /**
+   * @brief Whether a slot is claimed
+   */
+  bool is_attached() const noexcept { return slot_ != nullptr; }
+
+  /**
+   * @brief Whether the slot is still ours and the collector is alive
+   * @param timeout Collector heartbeat age after which it counts as gone
+   *
+   * False once the collector stopped or reclaimed the slot, e.g. after this
+   * process stalled past the producer timeout; the producer should then
+   * detach and attach again.
+   */
+  bool is_connected(std::chrono::nanoseconds timeout) const noexcept;
+
+  /**
+   * @brief Name a dictionary index
+   * @param index Index below kSharedDictionaryCapacity
+   * @param name Component name, at most 255 bytes
+   * @return false if the index or name does not fit, or the slot was
+   *         reclaimed
+   */
+  bool define_component(uint32_t index, const std::string &name) noexcept;
+
+  /**
+   * @brief Queue a record for the collector
+   * @return false if the ring is full, in which case the record is counted
+   *         as dropped, or if the slot was reclaimed
+   */
+  bool append(const TraceRecord &record) noexcept;
+
+  /**
+   * @brief Publish liveness and the current clock offset
+   */
+  void heartbeat() noexcept;
+
+private:
+  bool owns_slot() const noexcept;
+
+  void *mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+  void *slot_ = nullptr;
+  uint32_t generation_ = 0; ///< Slot generation at claim
+  uint64_t head_cache_ = 0; ///< Last collector position seen
+};
+
+/**
+ * @class SharedTimingCollector
+ * @brief Owner and reader side of a segment
+ *
+ * Thread Safety: not thread-safe; callers provide external locking.
+ */
+class SharedTimingCollector {
+public:
+  /// Producer slot states
+  enum class SlotState : uint32_t {
+    FREE = 0,     ///< Available to producers
+    CLAIMED = 1,  ///< Being reset by a producer; not yet readable
+    ACTIVE = 2,   ///< Producer attached
+    DETACHED = 3  ///< Producer left; remaining records still readable
+  };
+
+  /// Identity and liveness of the producer in a slot
+  struct ProducerInfo {
+    SlotState state = SlotState::FREE;
+    uint32_t generation = 0; ///< Changes whenever the slot is claimed
+    int pid = 0;
+    std::string label;
+    int64_t heartbeat_ns = 0;    ///< CLOCK_REALTIME of the last heartbeat
+    int64_t clock_offset_ns = 0; ///< Producer steady clock to CLOCK_REALTIME
+    uint64_t dropped = 0;        ///< Records the producer could not queue
+  };
+
+  /// Named dictionary entry of a producer
+  struct Component {
+    uint32_t index;
+    std::string name;
+  };
+
+  SharedTimingCollector() = default;
+  ~SharedTimingCollector() { close(); }
+  SharedTimingCollector(const SharedTimingCollector &) = delete;
+  SharedTimingCollector &operator=(const SharedTimingCollector &) = delete;
+
+  /**
+   * @brief Create the segment, replacing a stale one of the same name
+   * @param segment_name POSIX shared memory name, e.g. "/ivv_timing"
+   * @param producer_capacity Producer slots
+   * @param ring_capacity Records per producer, rounded up to a power of two
+   * @return false if the segment could not be created or mapped
+   */
+  bool create(const std::string &segment_name, uint32_t producer_capacity,
+              uint32_t ring_capacity);
+
+  /**
+   * @brief Mark the segment closed, unlink its name and unmap it
+   *
+   * Attached producers notice through is_connected() and keep their own
+   * mapping until they detach.
+   */
+  void close() noexcept;
+
+  /**
+   * @brief Whether a segment is open
+   */
+  bool is_open() const noexcept { return mapping_ != nullptr; }
+
+  /**
+   * @brief Number of producer slots
+   */
+  uint32_t producer_capacity() const noexcept { return producer_capacity_; }
+
+  /**
+   * @brief Publish collector liveness to the producers
+   */
+  void heartbeat() noexcept;
+
+  /**
+   * @brief Read a slot's state and producer identity
+   */
+  ProducerInfo producer(uint32_t slot) const;
+
+  /**
+   * @brief Position after the newest record of a slot
+   *
+   * Dictionary entries used by records before this position are visible
+   * once it has been read.
+   */
+  uint64_t tail(uint32_t slot) const noexcept;
+
+  /**
+   * @brief Append dictionary entries named since the last call
+   * @param slot Slot to read
+   * @param next_index First index not read yet; advanced past what is read
+   * @param components Receives the new entries
+   */
+  void read_components(uint32_t slot, uint32_t &next_index,
+                       std::vector<Component> &components) const;
+
+  /**
+   * @brief Consume records up to a position
+   * @param slot Slot to read
+   * @param tail Position returned by tail()
+   * @param consumer Callable invoked with a const TraceRecord&
+   * @return Number of records consumed
+   */
+  template <typename Consumer>
+  uint64_t drain(uint32_t slot, uint64_t tail, Consumer &&consumer) {
+    const TraceRecord *ring = records(slot);
+    uint64_t head = load_head(slot);
+    for (uint64_t position = head; position != tail; ++position) {
+      consumer(ring[position & ring_mask_]);
+    }
+    store_head(slot, tail);
+    return tail - head;
+  }
+
+  /**
+   * @brief Return a drained detached or dead producer's slot to the pool
+   */
+  void release(uint32_t slot) noexcept;
+
+private:
+  const TraceRecord *records(uint32_t slot) const noexcept;
+  uint64_t load_head(uint32_t slot) const noexcept;
+  void store_head(uint32_t slot, uint64_t head) noexcept;
+
+  std::string name_;
+  void *mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+  uint32_t producer_capacity_ = 0;
+  uint64_t ring_mask_ = 0;
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
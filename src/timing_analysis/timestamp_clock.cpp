@@ -0,0 +1,209 @@
+/**
+ * @file timestamp_clock.cpp
+ * @brief Raw timestamp source and TSC calibration implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "timestamp_clock.h"
+
+#if IVV_TIMING_HAS_TSC
+#include <cpuid.h>
+#endif
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+/// Busy-wait used for the initial TSC frequency estimate
+constexpr int64_t kCalibrationIntervalNs = 10000000; // 10 ms
+
+/// Minimum spacing between drift re-calibrations
+constexpr int64_t kRecalibrationPeriodNs = 1000000000; // 1 s
+
+/// Plausible TSC frequencies: 100 MHz to 10 GHz
+constexpr double kMinNsPerTick = 0.1;
+constexpr double kMaxNsPerTick = 10.0;
+
+int64_t steady_now_ns() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+} // anonymous namespace
+
+bool TimestampClock::invariant_tsc_available() noexcept {
+#if IVV_TIMING_HAS_TSC
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (!__get_cpuid(0x80000000u, &eax, &ebx, &ecx, &edx) ||
+      eax < 0x80000007u) {
+    return false;
+  }
+
+  // RDTSCP: CPUID.80000001H:EDX[27]
+  if (!__get_cpuid(0x80000001u, &eax, &ebx, &ecx, &edx) ||
+      (edx & (1u << 27)) == 0) {
+    return false;
+  }
+
+  // Invariant TSC: CPUID.80000007H:EDX[8]
+  if (!__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx)) {
+    return false;
+  }
+  return (edx & (1u << 8)) != 0;
+#else
+  return false;
+#endif
+}
+
+TimestampClock::ReferencePoint TimestampClock::read_reference() noexcept {
+  ReferencePoint best;
+#if IVV_TIMING_HAS_TSC
+  // Bracket the steady_clock read with TSC reads and keep the tightest pair
+  uint64_t best_window = UINT64_MAX;
+  for (int attempt = 0; attempt < 5; ++attempt) {
+    unsigned int aux;
+    uint64_t before = __rdtscp(&aux);
+    int64_t steady_ns = steady_now_ns();
+    uint64_t after = __rdtscp(&aux);
+
+    if (after - before < best_window) {
+      best_window = after - before;
+      best.ticks = before + (after - before) / 2;
+      best.steady_ns = steady_ns;
+    }
+  }
+#else
+  best.steady_ns = steady_now_ns();
+  best.ticks = static_cast<uint64_t>(best.steady_ns);
+#endif
+  return best;
+}
+
+ClockSource TimestampClock::configure(ClockSource requested) noexcept {
+  use_tsc_.store(false, std::memory_order_relaxed);
+  store_calibration(Calibration{});
+
+  if (requested != ClockSource::TSC || !invariant_tsc_available()) {
+    return ClockSource::STEADY_CLOCK;
+  }
+
+  ReferencePoint begin = read_reference();
+  ReferencePoint end;
+  do {
+    end = read_reference();
+  } while (end.steady_ns - begin.steady_ns < kCalibrationIntervalNs);
+
+  if (end.ticks <= begin.ticks) {
+    return ClockSource::STEADY_CLOCK;
+  }
+
+  double ns_per_tick = static_cast<double>(end.steady_ns - begin.steady_ns) /
+                       static_cast<double>(end.ticks - begin.ticks);
+  if (!(ns_per_tick >= kMinNsPerTick && ns_per_tick <= kMaxNsPerTick)) {
+    return ClockSource::STEADY_CLOCK;
+  }
+
+  base_ = begin;
+  last_calibration_ns_ = end.steady_ns;
+  store_calibration(Calibration{ns_per_tick, end.ticks, end.steady_ns});
+  use_tsc_.store(true, std::memory_order_relaxed);
+  return ClockSource::TSC;
+}
+
+bool TimestampClock::recalibrate_if_due() noexcept {
+  if (!use_tsc_.load(std::memory_order_relaxed) ||
+      steady_now_ns() - last_calibration_ns_ < kRecalibrationPeriodNs) {
+    return false;
+  }
+
+  // Measure the rate over the whole run since the first calibration so the
+  // estimate keeps improving, and re-anchor at the current point
+  ReferencePoint now = read_reference();
+  if (now.ticks <= base_.ticks) {
+    return false;
+  }
+
+  double ns_per_tick = static_cast<double>(now.steady_ns - base_.steady_ns) /
+                       static_cast<double>(now.ticks - base_.ticks);
+  if (!(ns_per_tick >= kMinNsPerTick && ns_per_tick <= kMaxNsPerTick)) {
+    return false;
+  }
+
+  last_calibration_ns_ = now.steady_ns;
+  store_calibration(Calibration{ns_per_tick, now.ticks, now.steady_ns});
+  return true;
+}
+
+int64_t TimestampClock::ticks_to_ns(const Calibration &calibration,
+                                    uint64_t ticks) noexcept {
+  auto delta = static_cast<int64_t>(ticks - calibration.anchor_ticks);
+  return calibration.anchor_ns +
+         static_cast<int64_t>(static_cast<double>(delta) *
+                              calibration.ns_per_tick);
+}
+
+std::chrono::steady_clock::time_point
+TimestampClock::to_time_point(uint64_t ticks) const noexcept {
+  int64_t steady_ns = use_tsc_.load(std::memory_order_relaxed)
+                          ? ticks_to_ns(load_calibration(), ticks)
+                          : static_cast<int64_t>(ticks);
+
+  return std::chrono::steady_clock::time_point(
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::nanoseconds(steady_ns)));
+}
+
+void TimestampClock::convert(uint64_t start_ticks, uint64_t end_ticks,
+                             TimingSample &sample) const noexcept {
+  int64_t start_ns;
+  int64_t end_ns;
+  if (use_tsc_.load(std::memory_order_relaxed)) {
+    Calibration calibration = load_calibration();
+    start_ns = ticks_to_ns(calibration, start_ticks);
+    end_ns = ticks_to_ns(calibration, end_ticks);
+  } else {
+    start_ns = static_cast<int64_t>(start_ticks);
+    end_ns = static_cast<int64_t>(end_ticks);
+  }
+
+  sample.start_time = std::chrono::steady_clock::time_point(
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::nanoseconds(start_ns)));
+  sample.end_time = std::chrono::steady_clock::time_point(
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::nanoseconds(end_ns)));
+  sample.execution_time = std::chrono::nanoseconds(end_ns - start_ns);
+}
+
+TimestampClock::Calibration TimestampClock::load_calibration() const noexcept {
+  Calibration calibration;
+  uint32_t sequence;
+  do {
+    sequence = sequence_.load(std::memory_order_acquire);
+    calibration.ns_per_tick = ns_per_tick_.load(std::memory_order_relaxed);
+    calibration.anchor_ticks = anchor_ticks_.load(std::memory_order_relaxed);
+    calibration.anchor_ns = anchor_ns_.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((sequence & 1u) != 0 ||
+           sequence != sequence_.load(std::memory_order_relaxed));
+  return calibration;
+}
+
+void TimestampClock::store_calibration(
+    const Calibration &calibration) noexcept {
+  uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+  sequence_.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  ns_per_tick_.store(calibration.ns_per_tick, std::memory_order_relaxed);
+  anchor_ticks_.store(calibration.anchor_ticks, std::memory_order_relaxed);
+  anchor_ns_.store(calibration.anchor_ns, std::memory_order_relaxed);
+  sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
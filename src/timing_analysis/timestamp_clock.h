@@ -0,0 +1,105 @@
+/**
+ * @file timestamp_clock.h
+ * @brief Raw timestamp source for the timing measurement path
+ *
+ * Reads either steady_clock nanoseconds or invariant TSC cycles. Raw ticks
+ * are converted to steady_clock time only when samples are analyzed, using
+ * a calibration that is re-anchored against CLOCK_MONOTONIC for drift.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include "timing_analyzer.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @class TimestampClock
+ * @brief Tick source with deferred conversion to steady_clock time
+ *
+ * Thread Safety: now(), elapsed() and to_time_point() may be called from
+ * any thread. configure() must not race with measurements; recalibrate()
+ * requires a single writer (the analyzer calls it under its ingest lock).
+ */
+class TimestampClock : public TickCounter {
+public:
+  /**
+   * @brief Select the tick source, calibrating the TSC if requested
+   * @param requested Desired clock source
+   * @return Clock source in effect (STEADY_CLOCK on fallback)
+   */
+  ClockSource configure(ClockSource requested) noexcept;
+
+  /**
+   * @brief Clock source in effect
+   */
+  ClockSource source() const noexcept {
+    return use_tsc_.load(std::memory_order_relaxed) ? ClockSource::TSC
+                                                    : ClockSource::STEADY_CLOCK;
+  }
+
+  /**
+   * @brief Convert a raw tick reading to steady_clock time
+   */
+  std::chrono::steady_clock::time_point
+  to_time_point(uint64_t ticks) const noexcept;
+
+  /**
+   * @brief Convert a start/end tick pair using one calibration snapshot
+   * @param start_ticks Raw reading taken at measurement start
+   * @param end_ticks Raw reading taken at measurement end
+   * @param sample Receives start_time, end_time and execution_time
+   */
+  void convert(uint64_t start_ticks, uint64_t end_ticks,
+               TimingSample &sample) const noexcept;
+
+  /**
+   * @brief Re-anchor the TSC calibration if the re-calibration period passed
+   * @return true if the calibration was updated
+   */
+  bool recalibrate_if_due() noexcept;
+
+  /**
+   * @brief Whether this CPU provides an invariant TSC readable with rdtscp
+   */
+  static bool invariant_tsc_available() noexcept;
+
+private:
+  struct Calibration {
+    double ns_per_tick = 1.0;
+    uint64_t anchor_ticks = 0;
+    int64_t anchor_ns = 0;
+  };
+
+  /// Paired TSC and CLOCK_MONOTONIC reading taken back to back
+  struct ReferencePoint {
+    uint64_t ticks = 0;
+    int64_t steady_ns = 0;
+  };
+
+  static ReferencePoint read_reference() noexcept;
+  static int64_t ticks_to_ns(const Calibration &calibration,
+                             uint64_t ticks) noexcept;
+  Calibration load_calibration() const noexcept;
+  void store_calibration(const Calibration &calibration) noexcept;
+
+  ReferencePoint base_; ///< First calibration point
+  int64_t last_calibration_ns_ = 0;
+
+  // Seqlock-published calibration: odd sequence while being written
+  std::atomic<uint32_t> sequence_{0};
+  std::atomic<double> ns_per_tick_{1.0};
+  std::atomic<uint64_t> anchor_ticks_{0};
+  std::atomic<int64_t> anchor_ns_{0};
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
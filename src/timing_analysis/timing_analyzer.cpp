@@ -11,39 +11,200 @@
  */
 
 #include "timing_analyzer.h"
+#include "history_tiers.h"
+#include "jitter_tracker.h"
+#include "lock_free_ring.h"
+#include "perf_counter_group.h"
+#include "realtime_thread.h"
+#include "resource_sampler.h"
+#include "sampling_engine.h"
+#include "running_statistics.h"
+#include "sample_history.h"
+#include "shared_timing_segment.h"
+#include "timestamp_clock.h"
+#include "trace_file.h"
+#include "trace_point_log.h"
+#include "worker_pool.h"
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cmath>
 #include <cstdio>
+#include <condition_variable>
 #include <cstdlib>
 #include <mutex>
 #include <numeric>
+#include <shared_mutex>
+#include <system_error>
 #include <thread>
 #include <unordered_map>
 
 namespace IVVFramework {
 namespace TimingAnalysis {
 
+namespace {
+
+// Measurement slot configuration. Each thread owns kSlotsPerThread slots for
+// in-flight measurements and a ring of completed samples awaiting ingest.
+constexpr uint32_t kSlotsPerThread = 256;
+constexpr uint32_t kMaxComponents = 4096;
+constexpr uint32_t kMaxThreadContexts = 1024;
+constexpr size_t kCompletedRingCapacity = 4096;
+constexpr size_t kCompletedRingHighWater = kCompletedRingCapacity * 3 / 4;
+
+// Longest the idle ingest thread sleeps before draining the completion
+// rings anyway, and how often it may log measurement path losses
+constexpr auto kIngestPoll = std::chrono::milliseconds(5);
+constexpr auto kLossReportPeriod = std::chrono::seconds(1);
+
+// Distinct span call paths tracked; spans on further paths still count
+// towards their component but are left out of the call tree
+constexpr uint32_t kMaxSpanNodes = 4096;
+constexpr uint32_t kNoParentSlot = kSlotsPerThread;
+
+// Trace events buffered per thread before the latency matcher consumes them
+constexpr size_t kTraceRingCapacity = 16384;
+constexpr size_t kTraceRingHighWater = kTraceRingCapacity * 3 / 4;
+
+// Recent events retained per trace point for correlation matching
+constexpr size_t kTraceLogCapacity = 8192;
+
+// Violations buffered per thread before the dispatcher processes them, and
+// the longest the idle dispatcher sleeps before checking the rings anyway
+constexpr size_t kViolationRingCapacity = 1024;
+constexpr auto kViolationDispatchPoll = std::chrono::milliseconds(20);
+
+// Largest shared memory segment a collector creates
+constexpr size_t kMaxSharedProducers = 1024;
+constexpr size_t kMaxSharedRing = size_t{1} << 30;
+
+// Period of the background pass that rolls up downsampled history
+constexpr auto kHistoryCompactionPeriod = std::chrono::milliseconds(250);
+constexpr int64_t kTrendSecondNs = 1000000000;
+
+// Longest downsampled tier ages a retention policy may request
+constexpr auto kMaxSecondTierAge = std::chrono::hours(24);
+constexpr auto kMaxMinuteTierAge = std::chrono::hours(24 * 30);
+
+// ViolationRecord::flags
+constexpr uint32_t kViolationDeadlineMiss = 1u << 0;
+constexpr uint32_t kViolationCheckSafety = 1u << 1;
+constexpr uint32_t kViolationCrossThread = 1u << 2;
+
+/// Peak utilization percentage above which a resource is flagged
+constexpr double kResourceSafetyThreshold = 85.0;
+
+// Measurement ID layout: [generation:40][thread:16][slot:8]
+constexpr unsigned kSlotBits = 8;
+constexpr unsigned kThreadBits = 16;
+constexpr uint64_t kGenerationMask = (uint64_t{1} << 40) - 1;
+
+// Slot state layout: [generation:62][phase:2]
+constexpr unsigned kPhaseBits = 2;
+constexpr uint64_t kPhaseMask = (uint64_t{1} << kPhaseBits) - 1;
+constexpr uint64_t kPhaseFree = 0;
+constexpr uint64_t kPhaseActive = 1;
+constexpr uint64_t kPhaseStopping = 2;
+
+std::atomic<uint64_t> g_next_analyzer_serial{1};
+
+/// Part of a span's execution time not spent in nested spans
+std::chrono::nanoseconds exclusive_time(std::chrono::nanoseconds execution_time,
+                                        uint64_t span_ticks,
+                                        uint64_t child_ticks) {
+  if (child_ticks == 0 || span_ticks == 0) {
+    return execution_time;
+  }
+  if (child_ticks >= span_ticks) {
+    return std::chrono::nanoseconds{0};
+  }
+  double share = static_cast<double>(span_ticks - child_ticks) /
+                 static_cast<double>(span_ticks);
+  return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(
+      static_cast<double>(execution_time.count()) * share)};
+}
+
+/// Trend entry of an aggregated interval
+HistoryInterval make_history_interval(int64_t start_ns, int64_t width_ns,
+                                      const RunningStatistics &running,
+                                      const LatencyHistogram &histogram) {
+  HistoryInterval interval;
+  interval.start_time = std::chrono::steady_clock::time_point(
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::nanoseconds(start_ns)));
+  interval.duration = std::chrono::nanoseconds(width_ns);
+  interval.measurement_count = running.count;
+  interval.deadline_misses = running.deadline_misses;
+  if (running.count > 0) {
+    interval.min_execution_time = std::chrono::nanoseconds(running.min_ns);
+    interval.max_execution_time = std::chrono::nanoseconds(running.max_ns);
+    interval.avg_execution_time = std::chrono::nanoseconds(
+        static_cast<std::chrono::nanoseconds::rep>(running.mean_ns));
+    interval.median_execution_time = histogram.value_at_percentile(0.5);
+    interval.p99_execution_time = histogram.value_at_percentile(0.99);
+  }
+  return interval;
+}
+
+/**
+ * @brief Owner of the analyzer's clock
+ *
+ * A base listed before TimingAnalyzer, so the clock is constructed before
+ * the TimingAnalyzer base takes its address for read_ticks().
+ */
+struct AnalyzerClock {
+  TimestampClock clock_;
+};
+
+} // anonymous namespace
+
 /**
  * @brief Concrete implementation of TimingAnalyzer
  */
-class TimingAnalyzerImpl : public TimingAnalyzer {
+class TimingAnalyzerImpl : private AnalyzerClock, public TimingAnalyzer {
 public:
   TimingAnalyzerImpl();
   virtual ~TimingAnalyzerImpl();
 
   // Override virtual methods from base class
   bool initialize() override;
+  bool initialize(ClockSource clock_source) override;
+  ClockSource get_clock_source() const override;
   bool configure_constraints(const std::string &component_name,
                              const TimingConstraint &constraints) override;
+  bool configure_constraints(ComponentId component,
+                             const TimingConstraint &constraints) override;
+  bool configure_retention(const std::string &component_name,
+                           const RetentionPolicy &policy) override;
+  bool configure_retention(ComponentId component,
+                           const RetentionPolicy &policy) override;
+  bool configure_histogram(const std::string &component_name,
+                           const HistogramConfig &config) override;
+  bool configure_histogram(ComponentId component,
+                           const HistogramConfig &config) override;
+  bool get_latency_histogram(ComponentId component,
+                             LatencyHistogram &histogram) override;
+  ComponentId register_component(const std::string &component_name) override;
+  std::string get_component_name(ComponentId component) const override;
   uint64_t start_measurement(const std::string &component_name) override;
+  uint64_t start_measurement(ComponentId component) override;
   TimingMeasurement stop_measurement(uint64_t measurement_id) override;
+  bool stop_measurement(uint64_t measurement_id,
+                        TimingSample &sample) override;
+  MeasurementStatistics get_measurement_statistics() const override;
+  void record_ticks(ComponentId component, uint64_t start_ticks,
+                    uint64_t end_ticks) noexcept override;
   PerformanceStatistics analyze_deadline_compliance(
       const std::string &component_name,
       std::chrono::nanoseconds analysis_window) override;
+  std::vector<HistoryInterval>
+  get_history_trend(const std::string &component_name,
+                    std::chrono::nanoseconds window) override;
   PerformanceStatistics measure_jitter(const std::string &component_name,
                                        size_t sample_count) override;
+  bool mark(ComponentId point, uint64_t correlation_id) override;
+  bool mark(const std::string &point, uint64_t correlation_id) override;
   PerformanceStatistics profile_latency(const std::string &start_point,
                                         const std::string &end_point,
                                         size_t sample_count) override;
@@ -54,64 +215,555 @@ public:
                                       double confidence_level) override;
   bool verify_timing_constraints() override;
   TimingAnalysisReport generate_report(bool include_raw_data) override;
+  std::vector<CallTreeNode> get_call_tree() override;
+  bool start_trace_recording(const std::string &path) override;
+  void stop_trace_recording() override;
+  bool import_trace(const std::string &path,
+                    const TraceReplayOptions &options) override;
   void set_verification_callback(TimingVerificationCallback callback) override;
   void set_resource_monitoring_callback(
       ResourceMonitoringCallback callback) override;
   void clear_measurements() override;
   std::chrono::steady_clock::time_point get_precise_timestamp() override;
   bool set_realtime_priority(bool enable) override;
+  bool configure_realtime(const RealtimeConfig &config) override;
+  RealtimeStatus get_realtime_status() const override;
   bool configure_sampling_rate(double sample_rate) override;
+  ComponentId register_probe(const std::string &probe_name,
+                             SamplingProbe probe) override;
+  bool unregister_probe(ComponentId probe) override;
+  bool start_sampling() override;
+  void stop_sampling() override;
+  SamplingStatistics get_sampling_statistics() const override;
+  bool enable_performance_counters(bool enable) override;
+  bool configure_violation_dispatch(ViolationOverflowPolicy policy) override;
+  ViolationDispatchStatistics get_violation_dispatch_statistics() const override;
+  bool flush_violations(std::chrono::milliseconds timeout) override;
+  bool start_shared_collector(const std::string &segment_name,
+                              const SharedMemoryConfig &config) override;
+  void stop_shared_collector() override;
+  bool start_shared_export(const std::string &segment_name,
+                           const std::string &process_label,
+                           const SharedMemoryConfig &config) override;
+  void stop_shared_export() override;
+  SharedMemoryStatistics get_shared_memory_statistics() const override;
 
 private:
-  struct ActiveMeasurement {
-    uint64_t id;
-    std::string component_name;
-    std::chrono::steady_clock::time_point start_time;
+  /// Per-component state; entries are never removed once created
+  struct ComponentState {
+    ComponentState(ComponentId component_id, std::string component_name)
+        : id(component_id), name(std::move(component_name)),
+          history(component_id) {}
+
+    const ComponentId id;
+    const std::string name;
+    SampleHistory history;     ///< Guarded by measurements_mutex_
+    RunningStatistics running; ///< All samples since clear; same guard
+    LatencyHistogram histogram; ///< All samples since clear; same guard
+    std::mutex jitter_mutex; ///< Leaf lock; after measurements_mutex_
+    JitterTracker jitter;    ///< Inter-arrival jitter; jitter_mutex
+    std::atomic<int64_t> last_jitter_ns{0}; ///< Published with each update
+    PerformanceCounterStatistics counter_stats; ///< measurements_mutex_
+    int64_t inclusive_ns = 0; ///< Outermost spans only; measurements_mutex_
+    int64_t exclusive_ns = 0; ///< measurements_mutex_
+    int64_t expected_interval_ns = 0; ///< Period for coordinated-omission
+                                      ///< correction, 0 when off; same guard
+    std::unique_ptr<LatencyHistogram> corrected_histogram; ///< Histogram
+                                      ///< with back-filled releases while
+                                      ///< correction is on; same guard
+
+    std::unique_ptr<TracePointLog> trace_log; ///< Guarded by trace_mutex_
+  };
+
+  /// Immutable constraints of every component, indexed by ComponentId.
+  /// configure_constraints publishes a modified copy; readers keep the
+  /// table they loaded alive through their shared_ptr.
+  struct ConstraintTable {
+    std::vector<std::shared_ptr<const TimingConstraint>> entries;
+
+    const TimingConstraint *find(ComponentId component) const noexcept {
+      return (component < entries.size()) ? entries[component].get()
+                                          : nullptr;
+    }
+  };
+
+  /// One distinct call path: a component below the path of its enclosing
+  /// span. Nodes are never removed once created.
+  struct SpanNode {
+    SpanNode(uint32_t node_index, const SpanNode *parent_node,
+             ComponentState *span_component, bool is_recursive)
+        : index(node_index), parent(parent_node), component(span_component),
+          recursive(is_recursive) {}
+
+    const uint32_t index;
+    const SpanNode *const parent; ///< nullptr for top-level spans
+    ComponentState *const component;
+    const bool recursive; ///< An enclosing span is of the same component
+    uint64_t calls = 0;        ///< Guarded by measurements_mutex_
+    int64_t inclusive_ns = 0;  ///< Guarded by measurements_mutex_
+    int64_t exclusive_ns = 0;  ///< Guarded by measurements_mutex_
+  };
+
+  /// Aggregates of one call path copied for off-lock tree building
+  struct SpanSnapshot {
+    const SpanNode *node = nullptr;
+    uint64_t calls = 0;
+    int64_t inclusive_ns = 0;
+    int64_t exclusive_ns = 0;
+  };
+
+  /// Span stack entry: an in-flight slot of the thread and the slot state
+  /// it was started with, so stale entries are recognized
+  struct SpanFrame {
+    uint32_t slot_index = 0;
+    uint64_t state = 0;
+  };
+
+  /// In-flight measurement owned by one thread context
+  struct ActiveSlot {
+    std::atomic<uint64_t> state{0}; ///< Generation and phase, see kPhase*
+    ComponentState *component = nullptr;
+    uint64_t start_ticks = 0; ///< Raw TimestampClock reading
     std::thread::id thread_id;
+    bool has_counters = false; ///< Whether start_counters was captured
+    PerfCounterGroup::Reading start_counters;
+
+    // Span nesting, written by the owning thread at start
+    SpanNode *span = nullptr; ///< Call path; nullptr when not tracked
+    const ComponentState *parent = nullptr; ///< Enclosing span's component
+    uint32_t parent_slot = kNoParentSlot;   ///< Enclosing span's slot
+    uint64_t parent_state = 0; ///< Enclosing slot state while in flight
+    std::atomic<uint64_t> child_ticks{0}; ///< Nested spans stopped so far
+  };
+
+  /// Completed measurement queued for ingest into the history; timestamps
+  /// stay in raw clock ticks until ingest
+  struct CompletedSample {
+    ComponentState *component = nullptr;
+    uint64_t start_ticks = 0;
+    uint64_t end_ticks = 0;
+    std::chrono::nanoseconds execution_time{0};
+    std::chrono::nanoseconds self_time{0}; ///< Outside nested spans
+    std::chrono::nanoseconds jitter{0};
+    bool jitter_tracked = false; ///< jitter was computed at stop
+    bool deadline_met = true;
+    bool cross_thread = false; ///< Stopped on another thread than started
+    bool deferred = false; ///< From record_ticks(); converted and judged
+                           ///< against its constraint at ingest
+    PerformanceCounters counters;
+    SpanNode *span = nullptr;
+    const ComponentState *parent = nullptr;
+    uint64_t child_ticks = 0;
+  };
+
+  /// Probe sampled on every sampling engine tick
+  struct RegisteredProbe {
+    ComponentState *component = nullptr;
+    SamplingProbe probe;
   };
 
+  /// Timing violation queued for the dispatcher thread
+  struct ViolationRecord {
+    const ComponentState *component = nullptr;
+    std::chrono::steady_clock::time_point start_time;
+    int64_t execution_ns = 0;
+    int64_t jitter_ns = 0;
+    uint32_t flags = 0; ///< See kViolation*
+  };
+
+  /// Lifetime aggregates of one component copied for off-lock reporting
+  struct ComponentSnapshot {
+    const ComponentState *component = nullptr;
+    RunningStatistics running;
+    LatencyHistogram histogram;
+    bool corrected = false; ///< corrected_histogram holds a copy
+    LatencyHistogram corrected_histogram;
+    PerformanceCounterStatistics counters;
+    int64_t inclusive_ns = 0;
+    int64_t exclusive_ns = 0;
+    uint64_t samples_evicted = 0;
+    size_t raw_offset = 0; ///< First retained sample in the raw snapshot
+    size_t raw_count = 0;
+  };
+
+  /// Collector-side view of one producer slot
+  struct CollectedProducer {
+    bool attached = false;
+    uint32_t generation = 0;
+    uint32_t next_index = 0; ///< First dictionary entry not resolved yet
+    uint64_t dropped = 0;    ///< Producer drop count already accounted
+    std::vector<ComponentState *> components; ///< By dictionary index
+  };
+
+  /// Destination of one trace file component during replay
+  struct ReplayTarget {
+    ComponentState *component = nullptr;
+    bool has_deadline = false;
+    int64_t deadline_ns = 0;
+  };
+
+  /// Timestamped trace event queued for the latency matcher
+  struct TraceEvent {
+    ComponentState *point = nullptr;
+    uint64_t correlation_id = 0;
+    uint64_t ticks = 0;
+  };
+
+  /// Per-thread measurement state; only the bound thread starts measurements
+  /// and pushes completed samples or trace events
+  struct ThreadContext {
+    explicit ThreadContext(uint32_t context_index)
+        : index(context_index), completed(kCompletedRingCapacity),
+          violations(kViolationRingCapacity) {
+      span_stack.reserve(kSlotsPerThread);
+    }
+
+    const uint32_t index;
+    std::atomic<bool> in_use{true};
+    std::atomic<bool> analyzer_alive{true};
+    uint32_t next_slot = 0;
+    std::array<ActiveSlot, kSlotsPerThread> slots;
+    SpscRing<CompletedSample> completed;
+    SpscRing<ViolationRecord> violations; ///< Drained by the dispatcher
+
+    /// Allocated by the bound thread on its first mark, then published
+    std::unique_ptr<SpscRing<TraceEvent>> trace_storage;
+    std::atomic<SpscRing<TraceEvent> *> trace_events{nullptr};
+
+    /// Name lookups resolved by this thread; avoids the registry lock
+    std::unordered_map<std::string, ComponentId> component_cache;
+
+    /// Spans of the bound thread in start order, innermost last, and the
+    /// call paths it has resolved, keyed like span_node_ids_
+    std::vector<SpanFrame> span_stack;
+    std::unordered_map<uint64_t, SpanNode *> span_node_cache;
+    uint64_t last_span_key = ~uint64_t{0}; ///< Path resolved last
+    SpanNode *last_span_node = nullptr;
+
+    /// Constraint table last loaded by the bound thread and the version it
+    /// was loaded at; reloaded only when constraint_version_ moves on
+    std::shared_ptr<const ConstraintTable> constraints;
+    uint64_t constraints_version = 0;
+
+    /// Opened by the bound thread on its first counted measurement
+    PerfCounterGroup counters;
+    bool counters_failed = false; ///< open() failed; do not retry
+  };
+
+  struct ThreadBinding {
+    uint64_t analyzer_serial;
+    std::shared_ptr<ThreadContext> context;
+  };
+
+  /// Thread-local list of contexts this thread is bound to, one per analyzer
+  struct ThreadBindings {
+    std::vector<ThreadBinding> entries;
+
+    /// Binding used last; serials are never reused, so a stale entry
+    /// cannot match
+    uint64_t last_serial = 0;
+    ThreadContext *last_context = nullptr;
+
+    ~ThreadBindings() {
+      for (auto &entry : entries) {
+        entry.context->in_use.store(false, std::memory_order_release);
+      }
+    }
+  };
+
+  static thread_local ThreadBindings thread_bindings_;
+
   std::mutex measurements_mutex_;
-  mutable std::mutex constraints_mutex_;
-  std::atomic<uint64_t> next_measurement_id_{1};
+  mutable std::shared_mutex components_mutex_;
+  std::mutex contexts_mutex_;
+  std::mutex trace_mutex_; ///< Latency matcher; after measurements_mutex_
+  TraceFileWriter trace_writer_; ///< Guarded by measurements_mutex_
+  std::vector<CompletedSample> drain_batch_; ///< Guarded by
+                                             ///< measurements_mutex_
+  // Constraints that record_ticks() samples are judged against at ingest;
+  // guarded by measurements_mutex_
+  std::shared_ptr<const ConstraintTable> ingest_constraints_;
+  uint64_t ingest_constraints_version_ = 0;
+
+  // Report snapshots are reused across reports so copying them under
+  // measurements_mutex_ does not allocate in the steady state. Both are
+  // guarded by report_mutex_, which is taken before measurements_mutex_.
+  std::mutex report_mutex_;
+  std::vector<ComponentSnapshot> report_snapshots_;
+  std::vector<TimingSample> raw_snapshot_;
+  std::vector<SpanSnapshot> report_spans_;
+  WorkerPool analysis_pool_; ///< Off-lock analysis and trace replay
   std::atomic<bool> initialized_{false};
   std::atomic<bool> realtime_enabled_{false};
   std::atomic<double> sampling_rate_{1000.0}; // 1kHz default
-
-  std::unordered_map<uint64_t, ActiveMeasurement> active_measurements_;
-  std::unordered_map<std::string, TimingConstraint> constraints_;
-  std::unordered_map<std::string, std::vector<TimingMeasurement>>
-      measurement_history_;
-
-  TimingVerificationCallback verification_callback_;
+  std::atomic<bool> counters_enabled_{false};
+
+  // Component registry: name lookup under components_mutex_, dense
+  // lock-free table indexed by ComponentId for the measurement path
+  std::unordered_map<std::string, ComponentId> component_ids_;
+  std::vector<std::unique_ptr<ComponentState>> component_storage_;
+  std::array<std::atomic<ComponentState *>, kMaxComponents> component_table_{};
+  std::atomic<uint32_t> component_count_{1}; // ID 0 is INVALID_COMPONENT_ID
+
+  // Span call paths: resolved under span_nodes_mutex_ on a thread's first
+  // use of a path, then from the thread's cache; the dense table lets the
+  // report enumerate them without the lock
+  std::mutex span_nodes_mutex_;
+  std::unordered_map<uint64_t, SpanNode *> span_node_ids_;
+  std::vector<std::unique_ptr<SpanNode>> span_node_storage_;
+  std::array<std::atomic<SpanNode *>, kMaxSpanNodes> span_node_table_{};
+  std::atomic<uint32_t> span_node_count_{0};
+
+  std::vector<std::shared_ptr<ThreadContext>> thread_contexts_;
+  std::array<std::atomic<ThreadContext *>, kMaxThreadContexts>
+      context_table_{};
+  std::atomic<uint32_t> context_count_{0};
+
+  // Copy-on-write constraints: published with atomic_store under
+  // constraints_mutex_, which only serializes writers. The version lets
+  // threads revalidate their cached table with one atomic load.
+  std::shared_ptr<const ConstraintTable> constraints_;
+  std::atomic<uint64_t> constraint_version_{1};
+  std::mutex constraints_mutex_;
+
+  // Swapped under callback_mutex_ and invoked outside it, so the dispatcher
+  // and inline dispatch may run the callback concurrently
+  std::shared_ptr<const TimingVerificationCallback> verification_callback_;
+  std::mutex callback_mutex_;
+  std::atomic<bool> has_verification_callback_{false};
   ResourceMonitoringCallback resource_callback_;
 
+  // Violation dispatch: stop paths push ViolationRecords onto their thread's
+  // ring and the dispatcher thread does the logging and callbacks
+  std::thread violation_dispatcher_;
+  std::mutex dispatch_mutex_; ///< Guards dispatch_stopping_ and the waits
+  std::condition_variable dispatch_wakeup_;
+  std::condition_variable dispatch_progress_;
+  bool dispatch_stopping_ = false;
+  std::atomic<bool> dispatcher_running_{false};
+  std::atomic<bool> dispatcher_waiting_{false};
+  std::atomic<ViolationOverflowPolicy> overflow_policy_{
+      ViolationOverflowPolicy::DROP};
+  // Violations found at ingest; pushed under measurements_mutex_, which
+  // serializes the producers
+  SpscRing<ViolationRecord> ingest_violations_{kViolationRingCapacity};
+  std::atomic<uint64_t> violations_queued_{0};
+  std::atomic<uint64_t> violations_dispatched_{0};
+  std::atomic<uint64_t> violations_inline_{0};
+  std::atomic<uint64_t> violations_dropped_{0};
+  std::atomic<uint64_t> safety_violations_{0};
+
+  // Real-time configuration of background threads. Each thread applies
+  // it to itself when realtime_generation_ moves past what it last saw.
+  mutable std::mutex realtime_mutex_;
+  std::condition_variable realtime_applied_;
+  RealtimeConfig realtime_config_;             ///< Guarded by realtime_mutex_
+  RealtimeStatus realtime_status_;             ///< Guarded by realtime_mutex_
+  uint64_t dispatcher_realtime_generation_ = 0; ///< Guarded by realtime_mutex_
+  std::atomic<uint64_t> realtime_generation_{0};
+
+  // Periodic probe sampling. probes_mutex_ is held for each probe pass, so
+  // once unregister_probe returns the probe is no longer running.
+  std::mutex sampling_mutex_; ///< Serializes engine start and stop
+  SamplingEngine sampling_engine_;
+  std::mutex probes_mutex_;
+  std::vector<RegisteredProbe> probes_;      ///< Guarded by probes_mutex_
+  uint64_t sampler_realtime_generation_ = 0; ///< Engine thread only
+
+  // Cross-process collection. The collector thread owns shared_collector_
+  // and collected_producers_ while it runs; ingest exports through
+  // shared_producer_, which the export thread reattaches, under
+  // measurements_mutex_.
+  std::mutex shared_control_mutex_; ///< Serializes starting and stopping
+  std::mutex shared_wait_mutex_;    ///< Guards the stopping flags
+  std::condition_variable shared_wakeup_;
+  bool shared_collector_stopping_ = false;
+  bool shared_export_stopping_ = false;
+  SharedMemoryConfig shared_collector_config_;
+  SharedTimingCollector shared_collector_;
+  std::vector<CollectedProducer> collected_producers_;
+  std::thread shared_collector_thread_;
+  SharedMemoryConfig shared_export_config_;
+  std::string shared_export_segment_;
+  std::string shared_export_label_;
+  SharedTimingProducer shared_producer_; ///< Guarded by measurements_mutex_
+  std::vector<uint32_t> shared_export_ids_; ///< Dictionary index + 1 by
+                                            ///< ComponentId; same guard
+  uint32_t shared_export_defined_ = 0; ///< Guarded by measurements_mutex_
+  std::thread shared_export_thread_;
+  // Thread state published for statistics; set under shared_control_mutex_
+  std::atomic<bool> shared_collecting_{false};
+  std::atomic<bool> shared_exporting_{false};
+  std::atomic<size_t> producers_active_{0};
+  std::atomic<uint64_t> producers_attached_{0};
+  std::atomic<uint64_t> producers_lost_{0};
+  std::atomic<uint64_t> records_collected_{0};
+  std::atomic<uint64_t> records_dropped_{0};
+  std::atomic<bool> export_attached_{false};
+  std::atomic<uint64_t> records_exported_{0};
+  std::atomic<uint64_t> export_dropped_{0};
+
+  // Background ingest: measuring threads only push onto their completion
+  // rings, and this thread drains them into the component state
+  std::mutex ingest_mutex_; ///< Guards the thread and its stopping flag
+  std::condition_variable ingest_wakeup_;
+  bool ingest_stopping_ = false;
+  std::thread ingest_thread_;
+  std::atomic<bool> ingest_waiting_{false};
+  std::atomic<uint64_t> starts_rejected_{0};
+  std::atomic<uint64_t> samples_dropped_{0};
+
+  // Background roll-up of downsampled history, started by the first
+  // retention policy that enables downsampling
+  std::mutex compaction_mutex_; ///< Guards the thread and its stopping flag
+  std::condition_variable compaction_wakeup_;
+  bool compaction_stopping_ = false;
+  std::thread compaction_thread_;
+
   // Simple logging helper
   void log_message(const std::string &level, const std::string &component,
                    const std::string &message) const {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
     std::printf("2025-07-09 [%s] [%s] %s\n", level.c_str(), component.c_str(),
                 message.c_str());
   }
 
+  // Measurement path helpers
+  ThreadContext *local_context();
+  ThreadContext *bind_thread_context();
+  ComponentState *find_component(const std::string &component_name) const;
+  ComponentState *component_state(ComponentId component) const noexcept;
+  template <typename Visitor> void for_each_component(Visitor &&visitor) const;
+  bool record_stop(uint64_t measurement_id, uint64_t end_ticks,
+                   TimingSample &sample);
+  bool complete_measurement(uint64_t measurement_id, uint64_t end_ticks,
+                            CompletedSample &sample);
+  void enqueue_completed(ThreadContext *context,
+                         const CompletedSample &sample);
+  void drain_completed_locked();
+  void ingest_sample_locked(const CompletedSample &sample);
+  void ingest_record_locked(ComponentState &component, TimingSample &record,
+                            SpanNode *span, bool jitter_tracked = false);
+  bool track_jitter(ComponentState &component, TimingSample &sample,
+                    bool wait);
+  void write_trace_record_locked(const ComponentState &component,
+                                 const TimingSample &record);
+  void drain_trace_events_locked();
+  bool read_thread_counters(ThreadContext &context,
+                            PerfCounterGroup::Reading &reading);
+  std::shared_ptr<const ConstraintTable> load_constraints() const;
+  const ConstraintTable *
+  cached_constraints(std::shared_ptr<const ConstraintTable> &table,
+                     uint64_t &version);
+  void publish_constraints(ComponentId component,
+                           std::shared_ptr<const TimingConstraint> constraint);
+
+  // Span helpers
+  SpanFrame *innermost_span(ThreadContext &context) noexcept;
+  void pop_span(ThreadContext &context, uint32_t slot_index,
+                uint64_t state) noexcept;
+  SpanNode *resolve_span_node(ThreadContext &context, const SpanNode *parent,
+                              ComponentState *component);
+  void snapshot_span_nodes_locked(std::vector<SpanSnapshot> &snapshots);
+  std::vector<CallTreeNode>
+  build_call_tree(const std::vector<SpanSnapshot> &snapshots) const;
+
+  void sample_probes();
+  uint32_t evaluate_deadline(ThreadContext *context,
+                             const ComponentState &component,
+                             TimingSample &sample);
+  uint32_t evaluate_deadline(const ConstraintTable &constraints,
+                             const ComponentState &component,
+                             TimingSample &sample) const;
+
+  // Real-time helpers
+  void apply_realtime_to_current_thread();
+  std::function<void()> realtime_thread_setup();
+
+  // Violation dispatch helpers
+  void start_violation_dispatcher();
+  void stop_violation_dispatcher();
+  void run_violation_dispatcher();
+  void queue_violation(ThreadContext *context, const ComponentState &component,
+                       const TimingSample &sample, uint32_t flags);
+  void queue_ingest_violation_locked(const ComponentState &component,
+                                     const TimingSample &sample,
+                                     uint32_t flags);
+  size_t dispatch_queued_violations();
+  bool violations_pending() const;
+  void dispatch_violation(const ViolationRecord &record);
+
+  // History compaction helpers
+  void start_history_compaction();
+  void stop_history_compaction();
+  void run_history_compaction();
+
+  // Sample ingest helpers
+  void start_sample_ingest();
+  void stop_sample_ingest();
+  void run_sample_ingest();
+  void report_measurement_losses(uint64_t &reported_rejected,
+                                 uint64_t &reported_dropped);
+
+  // Shared-memory helpers
+  void run_shared_collector();
+  void collect_shared_records();
+  void run_shared_export();
+  bool attach_shared_export_locked();
+  void export_shared_record_locked(const ComponentState &component,
+                                   const TimingSample &record);
+
   // Helper methods
   bool
   validate_component_name(const std::string &component_name) const noexcept;
-  PerformanceStatistics calculate_statistics(
-      const std::string &component_name,
-      const std::vector<TimingMeasurement> &measurements) const;
-  bool check_safety_constraints(const TimingMeasurement &measurement) const;
+  PerformanceStatistics calculate_statistics(const ComponentState &component,
+                                             size_t first_index = 0,
+                                             double wcet_percentile = 0.999,
+                                             bool lifetime = false) const;
+  PerformanceStatistics
+  calculate_tiered_statistics(const ComponentState &component,
+                              int64_t cutoff_ns) const;
+  void apply_running_statistics(PerformanceStatistics &stats,
+                                const RunningStatistics &running) const;
+  void apply_lifetime_statistics(PerformanceStatistics &stats,
+                                 const RunningStatistics &running,
+                                 const LatencyHistogram &histogram,
+                                 double wcet_percentile) const;
+  void apply_corrected_statistics(PerformanceStatistics &stats,
+                                  const LatencyHistogram &corrected) const;
+  TimingMeasurement make_measurement(const ComponentState &component,
+                                     const TimingSample &sample) const;
+  bool check_safety_constraints(const ComponentState &component,
+                                const TimingConstraint &constraint,
+                                const TimingSample &sample);
   void log_timing_violation(const std::string &component_name,
-                            const TimingMeasurement &measurement) const;
-  std::chrono::nanoseconds
-  calculate_jitter(const std::vector<TimingMeasurement> &measurements) const;
+                            const TimingSample &sample) const;
 };
 
-TimingAnalyzerImpl::TimingAnalyzerImpl() {
-  // Constructor implementation
-}
+thread_local TimingAnalyzerImpl::ThreadBindings
+    TimingAnalyzerImpl::thread_bindings_;
+
+TimingAnalyzerImpl::TimingAnalyzerImpl()
+    : AnalyzerClock(), TimingAnalyzer(clock_),
+      constraints_(std::make_shared<const ConstraintTable>()) {}
 
 TimingAnalyzerImpl::~TimingAnalyzerImpl() {
+  stop_shared_export();
+  stop_shared_collector();
+  stop_history_compaction();
+  stop_sampling();
+  stop_sample_ingest();
+  stop_trace_recording();
+  stop_violation_dispatcher();
+
+  {
+    // Thread bindings may outlive the analyzer; mark our contexts stale so
+    // threads drop them on their next binding
+    std::lock_guard<std::mutex> lock(contexts_mutex_);
+    for (auto &context : thread_contexts_) {
+      context->analyzer_alive.store(false, std::memory_order_release);
+    }
+  }
+
   if (initialized_.load()) {
     log_message("CRITICAL", "TimingAnalyzer",
                 "TimingAnalyzer shutting down [SAFETY_CRITICAL]");
@@ -119,6 +771,10 @@ TimingAnalyzerImpl::~TimingAnalyzerImpl() {
 }
 
 bool TimingAnalyzerImpl::initialize() {
+  return initialize(ClockSource::STEADY_CLOCK);
+}
+
+bool TimingAnalyzerImpl::initialize(ClockSource clock_source) {
   std::lock_guard<std::mutex> lock(measurements_mutex_);
 
   if (initialized_.load()) {
@@ -127,16 +783,33 @@ bool TimingAnalyzerImpl::initialize() {
 
   try {
     // Initialize internal state
-    active_measurements_.clear();
-    constraints_.clear();
-    measurement_history_.clear();
+    drain_completed_locked();
+    for_each_component([](ComponentState &component) {
+      component.history.clear();
+      component.running.clear();
+      component.histogram.clear();
+      {
+        std::lock_guard<std::mutex> jitter_lock(component.jitter_mutex);
+        component.jitter.clear();
+      }
+      component.last_jitter_ns.store(0, std::memory_order_relaxed);
+      component.expected_interval_ns = 0;
+      component.corrected_histogram.reset();
+    });
+    publish_constraints(INVALID_COMPONENT_ID, nullptr); // Clears the table
 
     // Reset atomic variables
-    next_measurement_id_.store(1);
     realtime_enabled_.store(false);
     sampling_rate_.store(1000.0);
 
+    if (clock_.configure(clock_source) != clock_source) {
+      log_message("WARNING", "TimingAnalyzer",
+                  "Invariant TSC unavailable; using steady_clock timestamps");
+    }
+
     initialized_.store(true);
+    start_violation_dispatcher();
+    start_sample_ingest();
 
     log_message("INFO", "TimingAnalyzer",
                 "TimingAnalyzer initialized successfully");
@@ -150,6 +823,10 @@ bool TimingAnalyzerImpl::initialize() {
   }
 }
 
+ClockSource TimingAnalyzerImpl::get_clock_source() const {
+  return clock_.source();
+}
+
 bool TimingAnalyzerImpl::configure_constraints(
     const std::string &component_name, const TimingConstraint &constraints) {
   if (!initialized_.load()) {
@@ -160,18 +837,227 @@ bool TimingAnalyzerImpl::configure_constraints(
     return false;
   }
 
+  return configure_constraints(register_component(component_name),
+                               constraints);
+}
+
+bool TimingAnalyzerImpl::configure_constraints(
+    ComponentId component_id, const TimingConstraint &constraints) {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  ComponentState *component = component_state(component_id);
+  if (component == nullptr) {
+    return false;
+  }
+
   if (!TimingUtils::validate_timing_constraint(constraints)) {
     log_message("ERROR", "TimingAnalyzer",
-                "Invalid timing constraint for component: " + component_name);
+                "Invalid timing constraint for component: " + component->name);
     return false;
   }
 
-  std::lock_guard<std::mutex> lock(constraints_mutex_);
-  constraints_[component_name] = constraints;
+  // Measurements in flight finish against the table they loaded
+  publish_constraints(component_id,
+                      std::make_shared<const TimingConstraint>(constraints));
+
+  // The corrected histogram starts from the samples recorded so far, so it
+  // stays comparable with the uncorrected one
+  int64_t expected_interval_ns = constraints.correct_coordinated_omission
+                                     ? constraints.period.count()
+                                     : 0;
+  try {
+    std::lock_guard<std::mutex> lock(measurements_mutex_);
+    drain_completed_locked();
+    if (expected_interval_ns == 0) {
+      component->corrected_histogram.reset();
+    } else if (!component->corrected_histogram) {
+      component->corrected_histogram =
+          std::make_unique<LatencyHistogram>(component->histogram);
+    }
+    component->expected_interval_ns = expected_interval_ns;
+  } catch (const std::exception &e) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Failed to allocate corrected histogram for " +
+                    component->name + ": " + std::string(e.what()));
+    return false;
+  }
+
+  log_message("INFO", "TimingAnalyzer",
+              "Configured timing constraints for: " + component->name);
+
+  return true;
+}
+
+ComponentId
+TimingAnalyzerImpl::register_component(const std::string &component_name) {
+  if (!validate_component_name(component_name)) {
+    return INVALID_COMPONENT_ID;
+  }
+
+  {
+    std::shared_lock<std::shared_mutex> lock(components_mutex_);
+    auto it = component_ids_.find(component_name);
+    if (it != component_ids_.end()) {
+      return it->second;
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(components_mutex_);
+  auto it = component_ids_.find(component_name);
+  if (it != component_ids_.end()) {
+    return it->second;
+  }
+
+  ComponentId component_id = component_count_.load(std::memory_order_relaxed);
+  if (component_id >= kMaxComponents) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Component limit reached; cannot register: " + component_name);
+    return INVALID_COMPONENT_ID;
+  }
+
+  component_storage_.push_back(
+      std::make_unique<ComponentState>(component_id, component_name));
+  component_table_[component_id].store(component_storage_.back().get(),
+                                       std::memory_order_release);
+  component_ids_.emplace(component_name, component_id);
+  component_count_.store(component_id + 1, std::memory_order_release);
+
+  return component_id;
+}
+
+std::string
+TimingAnalyzerImpl::get_component_name(ComponentId component_id) const {
+  const ComponentState *component = component_state(component_id);
+  return (component != nullptr) ? component->name : std::string{};
+}
+
+bool TimingAnalyzerImpl::configure_retention(const std::string &component_name,
+                                             const RetentionPolicy &policy) {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  if (!validate_component_name(component_name)) {
+    return false;
+  }
+
+  return configure_retention(register_component(component_name), policy);
+}
+
+bool TimingAnalyzerImpl::configure_retention(ComponentId component_id,
+                                             const RetentionPolicy &policy) {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  ComponentState *component = component_state(component_id);
+  if (component == nullptr) {
+    return false;
+  }
+
+  if (policy.max_samples == 0 || policy.max_age.count() < 0 ||
+      policy.aggregate_interval.count() <= 0 ||
+      policy.second_tier_age.count() < 0 ||
+      policy.second_tier_age > kMaxSecondTierAge ||
+      policy.minute_tier_age.count() < 0 ||
+      policy.minute_tier_age > kMaxMinuteTierAge) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Invalid retention policy for component: " + component->name);
+    return false;
+  }
+
+  try {
+    std::lock_guard<std::mutex> lock(measurements_mutex_);
+    drain_completed_locked();
+    component->history.set_policy(policy);
+    {
+      std::lock_guard<std::mutex> jitter_lock(component->jitter_mutex);
+      if (component->jitter.window() != policy.jitter_window) {
+        component->jitter.set_window(policy.jitter_window);
+      }
+    }
+    if (component->history.tiers().enabled()) {
+      start_history_compaction();
+    }
+  } catch (const std::exception &e) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Failed to allocate history for " + component->name + ": " +
+                    std::string(e.what()));
+    return false;
+  }
+
+  log_message("INFO", "TimingAnalyzer",
+              "Configured history retention for: " + component->name + " (" +
+                  std::to_string(policy.max_samples) + " samples)");
+
+  return true;
+}
+
+bool TimingAnalyzerImpl::configure_histogram(const std::string &component_name,
+                                             const HistogramConfig &config) {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  if (!validate_component_name(component_name)) {
+    return false;
+  }
+
+  return configure_histogram(register_component(component_name), config);
+}
+
+bool TimingAnalyzerImpl::configure_histogram(ComponentId component_id,
+                                             const HistogramConfig &config) {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  ComponentState *component = component_state(component_id);
+  if (component == nullptr) {
+    return false;
+  }
+
+  if (config.max_trackable.count() <= 0) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Invalid histogram configuration for component: " +
+                    component->name);
+    return false;
+  }
+
+  try {
+    LatencyHistogram histogram(config);
+    std::lock_guard<std::mutex> lock(measurements_mutex_);
+    drain_completed_locked();
+    if (component->corrected_histogram) {
+      *component->corrected_histogram = histogram;
+    }
+    component->histogram = std::move(histogram);
+  } catch (const std::exception &e) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Failed to allocate histogram for " + component->name + ": " +
+                    std::string(e.what()));
+    return false;
+  }
 
   log_message("INFO", "TimingAnalyzer",
-              "Configured timing constraints for: " + component_name);
+              "Configured latency histogram for: " + component->name + " (" +
+                  std::to_string(config.precision_bits) + " precision bits)");
+
+  return true;
+}
+
+bool TimingAnalyzerImpl::get_latency_histogram(ComponentId component_id,
+                                               LatencyHistogram &histogram) {
+  ComponentState *component = component_state(component_id);
+  if (component == nullptr) {
+    return false;
+  }
 
+  std::lock_guard<std::mutex> lock(measurements_mutex_);
+  drain_completed_locked();
+  histogram = component->histogram;
   return true;
 }
 
@@ -185,329 +1071,2508 @@ TimingAnalyzerImpl::start_measurement(const std::string &component_name) {
     return 0;
   }
 
-  uint64_t measurement_id = next_measurement_id_.fetch_add(1);
-  auto start_time = get_precise_timestamp();
+  ThreadContext *context = local_context();
+  if (context == nullptr) {
+    return 0;
+  }
 
-  ActiveMeasurement measurement{measurement_id, component_name, start_time,
-                                std::this_thread::get_id()};
+  ComponentId &component_id = context->component_cache[component_name];
+  if (component_id == INVALID_COMPONENT_ID) {
+    component_id = register_component(component_name);
+  }
 
-  std::lock_guard<std::mutex> lock(measurements_mutex_);
-  active_measurements_[measurement_id] = measurement;
+  return start_measurement(component_id);
+}
 
-  return measurement_id;
+uint64_t TimingAnalyzerImpl::start_measurement(ComponentId component_id) {
+  if (!initialized_.load()) {
+    return 0; // Invalid measurement ID
+  }
+
+  ComponentState *component = component_state(component_id);
+  ThreadContext *context = local_context();
+  if (component == nullptr || context == nullptr) {
+    return 0;
+  }
+
+  // The innermost span still in flight on this thread encloses this one;
+  // below an untracked path the call tree is not extended
+  const SpanFrame *enclosing = innermost_span(*context);
+  const ActiveSlot *parent =
+      (enclosing != nullptr) ? &context->slots[enclosing->slot_index] : nullptr;
+  SpanNode *span = nullptr;
+  if (parent == nullptr || parent->span != nullptr) {
+    span = resolve_span_node(*context, (parent != nullptr) ? parent->span
+                                                           : nullptr,
+                             component);
+  }
+
+  // Claim a free slot owned by this thread; no other thread claims from it
+  for (uint32_t probe = 0; probe < kSlotsPerThread; ++probe) {
+    uint32_t slot_index = (context->next_slot + probe) % kSlotsPerThread;
+    ActiveSlot &slot = context->slots[slot_index];
+
+    uint64_t state = slot.state.load(std::memory_order_acquire);
+    if ((state & kPhaseMask) != kPhaseFree) {
+      continue;
+    }
+
+    uint64_t generation = ((state >> kPhaseBits) + 1) & kGenerationMask;
+    if (generation == 0) {
+      generation = 1;
+    }
+
+    slot.component = component;
+    slot.thread_id = std::this_thread::get_id();
+    slot.has_counters = counters_enabled_.load(std::memory_order_relaxed) &&
+                        read_thread_counters(*context, slot.start_counters);
+    slot.span = span;
+    slot.parent = (parent != nullptr) ? parent->component : nullptr;
+    slot.parent_slot =
+        (enclosing != nullptr) ? enclosing->slot_index : kNoParentSlot;
+    slot.parent_state = (enclosing != nullptr) ? enclosing->state : 0;
+    slot.child_ticks.store(0, std::memory_order_relaxed);
+    slot.start_ticks = clock_.now();
+
+    uint64_t active_state = (generation << kPhaseBits) | kPhaseActive;
+    slot.state.store(active_state, std::memory_order_release);
+    context->next_slot = (slot_index + 1) % kSlotsPerThread;
+    context->span_stack.push_back(SpanFrame{slot_index, active_state});
+
+    return (generation << (kSlotBits + kThreadBits)) |
+           (uint64_t{context->index} << kSlotBits) | slot_index;
+  }
+
+  // Reported by the ingest thread; logging here would put I/O on the path
+  // of every start while the slots stay busy
+  starts_rejected_.fetch_add(1, std::memory_order_relaxed);
+  return 0;
 }
 
 TimingMeasurement
 TimingAnalyzerImpl::stop_measurement(uint64_t measurement_id) {
-  auto end_time = get_precise_timestamp();
+  uint64_t end_ticks = clock_.now();
 
   TimingMeasurement result{};
-  result.end_time = end_time;
+  result.end_time = clock_.to_time_point(end_ticks);
 
   if (!initialized_.load() || measurement_id == 0) {
     result.task_name = "INVALID";
     return result;
   }
 
-  std::lock_guard<std::mutex> lock(measurements_mutex_);
+  TimingSample sample{};
+  if (!record_stop(measurement_id, end_ticks, sample)) {
+    result.task_name = "NOT_FOUND";
+    return result;
+  }
+
+  return make_measurement(*component_state(sample.component), sample);
+}
+
+bool TimingAnalyzerImpl::stop_measurement(uint64_t measurement_id,
+                                          TimingSample &sample) {
+  uint64_t end_ticks = clock_.now();
+
+  sample = TimingSample{};
+
+  if (!initialized_.load() || measurement_id == 0) {
+    sample.end_time = clock_.to_time_point(end_ticks);
+    return false;
+  }
+
+  return record_stop(measurement_id, end_ticks, sample);
+}
+
+MeasurementStatistics TimingAnalyzerImpl::get_measurement_statistics() const {
+  MeasurementStatistics statistics;
+  statistics.starts_rejected = starts_rejected_.load();
+  statistics.samples_dropped = samples_dropped_.load();
+  return statistics;
+}
+
+bool TimingAnalyzerImpl::record_stop(uint64_t measurement_id,
+                                     uint64_t end_ticks,
+                                     TimingSample &sample) {
+  CompletedSample completed{};
+  if (!complete_measurement(measurement_id, end_ticks, completed)) {
+    sample.end_time = clock_.to_time_point(end_ticks);
+    return false;
+  }
+
+  ComponentState &component = *completed.component;
+  sample.component = component.id;
+  clock_.convert(completed.start_ticks, completed.end_ticks, sample);
+  completed.execution_time = sample.execution_time;
+  sample.counters = completed.counters;
+
+  uint64_t span_ticks = (completed.end_ticks > completed.start_ticks)
+                            ? completed.end_ticks - completed.start_ticks
+                            : 0;
+  sample.self_time = exclusive_time(sample.execution_time, span_ticks,
+                                    completed.child_ticks);
+  sample.parent = (completed.parent != nullptr) ? completed.parent->id
+                                                : INVALID_COMPONENT_ID;
+  completed.self_time = sample.self_time;
+
+  // Jitter includes the interval ending at this start
+  completed.jitter_tracked = track_jitter(component, sample, false);
+  completed.jitter = sample.jitter;
+
+  // Check deadline compliance. Logging and the safety check run on the
+  // violation dispatcher; without a verification callback only a missed
+  // deadline can fail the safety check. A cross-thread stop is reported
+  // there too.
+  ThreadContext *context = local_context();
+  uint32_t violation_flags = evaluate_deadline(context, component, sample);
+  if (completed.cross_thread) {
+    violation_flags |= kViolationCrossThread;
+  }
+  if (violation_flags != 0) {
+    queue_violation(context, component, sample, violation_flags);
+  }
+
+  // Hand the sample to the history through this thread's completion ring
+  completed.deadline_met = sample.deadline_met;
+  enqueue_completed(context, completed);
+
+  return true;
+}
+
+void TimingAnalyzerImpl::record_ticks(ComponentId component,
+                                      uint64_t start_ticks,
+                                      uint64_t end_ticks) noexcept {
+  ComponentState *state = component_state(component);
+  if (!initialized_.load(std::memory_order_relaxed) || state == nullptr) {
+    return;
+  }
+
+  try {
+    // Conversion and the constraint check wait for ingest; the scope only
+    // hands its ticks to this thread's completion ring
+    ThreadContext *context = local_context();
+    CompletedSample completed{};
+    completed.component = state;
+    completed.start_ticks = start_ticks;
+    completed.end_ticks = end_ticks;
+    completed.deferred = true;
+
+    // A timed scope encloses no spans but is nested in the innermost span
+    // of this thread
+    if (context != nullptr) {
+      const SpanFrame *enclosing = innermost_span(*context);
+      ActiveSlot *parent = (enclosing != nullptr)
+                               ? &context->slots[enclosing->slot_index]
+                               : nullptr;
+      if (parent == nullptr || parent->span != nullptr) {
+        completed.span = resolve_span_node(
+            *context, (parent != nullptr) ? parent->span : nullptr, state);
+      }
+      if (parent != nullptr) {
+        completed.parent = parent->component;
+        parent->child_ticks.fetch_add(
+            (end_ticks > start_ticks) ? end_ticks - start_ticks : 0,
+            std::memory_order_relaxed);
+      }
+    }
+    enqueue_completed(context, completed);
+  } catch (...) {
+    // Binding a new thread or resolving a new span path can allocate; a
+    // timer destructor must not throw, so the sample is dropped instead
+  }
+}
+
+uint32_t TimingAnalyzerImpl::evaluate_deadline(ThreadContext *context,
+                                               const ComponentState &component,
+                                               TimingSample &sample) {
+  if (context != nullptr) {
+    return evaluate_deadline(
+        *cached_constraints(context->constraints,
+                            context->constraints_version),
+        component, sample);
+  }
+  return evaluate_deadline(*load_constraints(), component, sample);
+}
+
+uint32_t TimingAnalyzerImpl::evaluate_deadline(
+    const ConstraintTable &constraints, const ComponentState &component,
+    TimingSample &sample) const {
+  const TimingConstraint *constraint = constraints.find(component.id);
+  if (constraint == nullptr) {
+    return 0;
+  }
+
+  sample.deadline_met = (sample.execution_time <= constraint->deadline);
+  if (!sample.deadline_met) {
+    return kViolationDeadlineMiss | kViolationCheckSafety;
+  }
+  return has_verification_callback_.load(std::memory_order_relaxed)
+             ? kViolationCheckSafety
+             : 0;
+}
+
+PerformanceStatistics TimingAnalyzerImpl::analyze_deadline_compliance(
+    const std::string &component_name,
+    std::chrono::nanoseconds analysis_window) {
+
+  std::lock_guard<std::mutex> lock(measurements_mutex_);
+  drain_completed_locked();
+
+  ComponentState *component = find_component(component_name);
+  if (component == nullptr) {
+    PerformanceStatistics stats{};
+    stats.component_name = component_name;
+    return stats;
+  }
+
+  // Samples are retained in start order; the start-time column is the index
+  auto now = std::chrono::steady_clock::now();
+  auto cutoff_time = now - analysis_window;
+
+  int64_t cutoff_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          cutoff_time.time_since_epoch())
+                          .count();
+
+  size_t first_index = component->history.lower_bound(cutoff_ns);
+
+  // A window reaching past the retained samples reads the aggregates of
+  // what was downsampled
+  const SampleHistory &history = component->history;
+  if (first_index == 0 && history.tiers().enabled() &&
+      history.evicted_count() > 0) {
+    return calculate_tiered_statistics(*component, cutoff_ns);
+  }
+
+  return calculate_statistics(*component, first_index);
+}
+
+std::vector<HistoryInterval>
+TimingAnalyzerImpl::get_history_trend(const std::string &component_name,
+                                      std::chrono::nanoseconds window) {
+  std::vector<HistoryInterval> trend;
+
+  std::lock_guard<std::mutex> lock(measurements_mutex_);
+  drain_completed_locked();
+
+  ComponentState *component = find_component(component_name);
+  if (component == nullptr) {
+    return trend;
+  }
+
+  int64_t cutoff_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          (std::chrono::steady_clock::now() - window)
+                              .time_since_epoch())
+                          .count();
+  const SampleHistory &history = component->history;
+  const HistoryTiers::Interval *newest_aggregate = nullptr;
+  history.tiers().for_each_since(
+      cutoff_ns, [&](const HistoryTiers::Interval &interval) {
+        trend.push_back(make_history_interval(interval.start_ns,
+                                              interval.width_ns,
+                                              interval.stats,
+                                              interval.histogram));
+        newest_aggregate = &interval;
+      });
+
+  // Retained samples are grouped per second; the second partly downsampled
+  // continues its aggregate
+  RunningStatistics running;
+  LatencyHistogram histogram(history.tiers().histogram_config());
+  int64_t second_ns = 0;
+  for (size_t i = history.lower_bound(cutoff_ns); i < history.size(); ++i) {
+    int64_t start = history.start_ns(i) - history.start_ns(i) % kTrendSecondNs;
+    if (running.count > 0 && start > second_ns) {
+      trend.push_back(make_history_interval(second_ns, kTrendSecondNs,
+                                            running, histogram));
+      running.clear();
+      histogram.clear();
+    }
+    if (running.count == 0) {
+      second_ns = start;
+      if (newest_aggregate != nullptr &&
+          newest_aggregate->width_ns == kTrendSecondNs &&
+          newest_aggregate->start_ns == start) {
+        trend.pop_back();
+        running = newest_aggregate->stats;
+        histogram = newest_aggregate->histogram;
+      }
+      newest_aggregate = nullptr;
+    }
+    running.add(history.execution_ns(i), history.deadline_met(i));
+    histogram.record(std::chrono::nanoseconds(history.execution_ns(i)));
+  }
+  if (running.count > 0) {
+    trend.push_back(
+        make_history_interval(second_ns, kTrendSecondNs, running, histogram));
+  }
+  return trend;
+}
+
+PerformanceStatistics
+TimingAnalyzerImpl::measure_jitter(const std::string &component_name,
+                                   size_t sample_count) {
+
+  std::lock_guard<std::mutex> lock(measurements_mutex_);
+  drain_completed_locked();
+
+  ComponentState *component = find_component(component_name);
+  if (component == nullptr) {
+    PerformanceStatistics stats{};
+    stats.component_name = component_name;
+    return stats;
+  }
+
+  // Take the last N measurements for jitter analysis
+  const auto &history = component->history;
+  size_t start_idx =
+      (history.size() > sample_count) ? history.size() - sample_count : 0;
+
+  auto stats = calculate_statistics(*component, start_idx);
+
+  // Calculate jitter-specific metrics
+  if (stats.measurement_count > 0) {
+    stats.jitter_coefficient =
+        static_cast<double>(stats.std_deviation.count()) /
+        static_cast<double>(stats.avg_execution_time.count());
+  }
+
+  return stats;
+}
+
+bool TimingAnalyzerImpl::mark(const std::string &point,
+                              uint64_t correlation_id) {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  if (!validate_component_name(point)) {
+    return false;
+  }
+
+  ThreadContext *context = local_context();
+  if (context == nullptr) {
+    return false;
+  }
+
+  ComponentId &point_id = context->component_cache[point];
+  if (point_id == INVALID_COMPONENT_ID) {
+    point_id = register_component(point);
+  }
+
+  return mark(point_id, correlation_id);
+}
+
+bool TimingAnalyzerImpl::mark(ComponentId point_id, uint64_t correlation_id) {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  ComponentState *point = component_state(point_id);
+  ThreadContext *context = local_context();
+  if (point == nullptr || context == nullptr) {
+    return false;
+  }
+
+  // Only the bound thread writes trace_storage, so a relaxed load suffices
+  SpscRing<TraceEvent> *ring =
+      context->trace_events.load(std::memory_order_relaxed);
+  if (ring == nullptr) {
+    try {
+      context->trace_storage =
+          std::make_unique<SpscRing<TraceEvent>>(kTraceRingCapacity);
+    } catch (const std::exception &e) {
+      log_message("ERROR", "TimingAnalyzer",
+                  "Failed to allocate trace buffer: " + std::string(e.what()));
+      return false;
+    }
+    ring = context->trace_storage.get();
+    context->trace_events.store(ring, std::memory_order_release);
+  }
+
+  TraceEvent event{point, correlation_id, clock_.now()};
+  while (!ring->try_push(event)) {
+    // Buffer full: the matcher has fallen behind, drain it ourselves
+    std::lock_guard<std::mutex> lock(trace_mutex_);
+    drain_trace_events_locked();
+  }
+
+  if (ring->size_approx() >= kTraceRingHighWater) {
+    std::unique_lock<std::mutex> lock(trace_mutex_, std::try_to_lock);
+    if (lock.owns_lock()) {
+      drain_trace_events_locked();
+    }
+  }
+
+  return true;
+}
+
+PerformanceStatistics
+TimingAnalyzerImpl::profile_latency(const std::string &start_point,
+                                    const std::string &end_point,
+                                    size_t sample_count) {
+  PerformanceStatistics stats{};
+  stats.component_name = start_point + "_to_" + end_point;
+
+  const ComponentState *start = find_component(start_point);
+  const ComponentState *end = find_component(end_point);
+  if (start == nullptr || end == nullptr || sample_count == 0) {
+    return stats;
+  }
+
+  std::vector<std::chrono::nanoseconds> latencies;
+  {
+    std::lock_guard<std::mutex> lock(trace_mutex_);
+    drain_trace_events_locked();
+
+    if (!start->trace_log || !end->trace_log) {
+      return stats;
+    }
+
+    // Pair the newest end events with start events of the same item
+    latencies.reserve(std::min(sample_count, end->trace_log->size()));
+    const TracePointLog &start_log = *start->trace_log;
+    end->trace_log->visit_newest_first(
+        [&](uint64_t correlation_id, uint64_t end_ticks) {
+          uint64_t start_ticks = 0;
+          if (start_log.find(correlation_id, start_ticks)) {
+            auto latency = clock_.to_time_point(end_ticks) -
+                           clock_.to_time_point(start_ticks);
+            if (latency.count() >= 0) {
+              latencies.push_back(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      latency));
+            }
+          }
+          return latencies.size() < sample_count;
+        });
+  }
+
+  if (latencies.empty()) {
+    return stats;
+  }
+
+  RunningStatistics running;
+  for (const auto &latency : latencies) {
+    running.add(latency.count(), true);
+  }
+  apply_running_statistics(stats, running);
+
+  auto percentiles = TimingUtils::calculate_percentiles(
+      std::move(latencies), {0.95, 0.99, 0.999, 0.5, 0.9999});
+  stats.wcet_estimate = percentiles[2];
+  stats.median_execution_time = percentiles[3];
+  stats.p9999_execution_time = percentiles[4];
+  percentiles.resize(3);
+  stats.percentiles = std::move(percentiles);
+
+  return stats;
+}
+
+ResourceUtilization TimingAnalyzerImpl::monitor_resource_utilization(
+    const std::string &resource_name,
+    std::chrono::nanoseconds monitoring_duration) {
+
+  ResourceUtilization result{};
+  result.resource_name = resource_name;
+  result.measurement_window = monitoring_duration;
+
+  if (resource_callback_) {
+    result = resource_callback_(resource_name);
+  } else {
+    ResourceSampler sampler;
+    if (sampler.run(ResourceSampler::resource_for(resource_name),
+                    monitoring_duration, sampling_rate_.load(), result,
+                    realtime_thread_setup())) {
+      result.exceeds_safety_threshold =
+          (result.peak_utilization > kResourceSafetyThreshold);
+    } else {
+      log_message("WARNING", "TimingAnalyzer",
+                  "Resource sampling unavailable for " + resource_name);
+    }
+  }
+
+  return result;
+}
+
+PerformanceStatistics
+TimingAnalyzerImpl::estimate_wcet(const std::string &component_name,
+                                  double confidence_level) {
+
+  std::lock_guard<std::mutex> lock(measurements_mutex_);
+  drain_completed_locked();
+
+  ComponentState *component = find_component(component_name);
+  if (component == nullptr) {
+    PerformanceStatistics stats{};
+    stats.component_name = component_name;
+    return stats;
+  }
+
+  // Simple WCET estimation using statistical approach: a high percentile
+  // of every sample, so eviction never forgets a worst case and the
+  // estimate agrees with the report
+  return calculate_statistics(*component, 0, confidence_level, true);
+}
+
+bool TimingAnalyzerImpl::verify_timing_constraints() {
+  std::lock_guard<std::mutex> measurements_lock(measurements_mutex_);
+  drain_completed_locked();
+
+  bool all_constraints_met = true;
+  std::shared_ptr<const ConstraintTable> constraints = load_constraints();
+
+  for_each_component([&](const ComponentState &component) {
+    const TimingConstraint *constraint = constraints->find(component.id);
+    if (constraint == nullptr) {
+      return;
+    }
+    double deadline_miss_threshold = constraint->deadline_miss_threshold;
+
+    const auto &history = component.history;
+    if (history.empty()) {
+      return; // No measurements for this component
+    }
+
+    // Calculate recent deadline miss rate
+    size_t recent_measurements = std::min(history.size(), size_t(100));
+    uint64_t deadline_misses =
+        history.deadline_misses(history.size() - recent_measurements);
+
+    double miss_rate = static_cast<double>(deadline_misses) /
+                       static_cast<double>(recent_measurements);
+
+    if (miss_rate > deadline_miss_threshold) {
+      all_constraints_met = false;
+
+      log_message("ERROR", "TimingAnalyzer",
+                  "Timing constraint violation for " + component.name +
+                      ": miss rate " + std::to_string(miss_rate * 100.0) + "%");
+    }
+  });
+
+  return all_constraints_met;
+}
+
+TimingAnalysisReport
+TimingAnalyzerImpl::generate_report(bool include_raw_data) {
+  TimingAnalysisReport report{};
+  report.analysis_timestamp = std::chrono::steady_clock::now();
+  report.target_system = "BCI_System"; // Could be configurable
+  report.overall_timing_compliance = verify_timing_constraints();
+
+  std::lock_guard<std::mutex> report_lock(report_mutex_);
+  size_t snapshot_count = 0;
+  size_t raw_count = 0;
+  {
+    // Only fixed-size aggregates are copied under the ingest lock; stop
+    // paths blocked on it wait for a few memcpys, not for the analysis
+    std::lock_guard<std::mutex> lock(measurements_mutex_);
+    drain_completed_locked();
+
+    for_each_component([&](const ComponentState &component) {
+      if (component.running.count == 0) {
+        return;
+      }
+      if (snapshot_count == report_snapshots_.size()) {
+        report_snapshots_.emplace_back();
+      }
+
+      ComponentSnapshot &snapshot = report_snapshots_[snapshot_count++];
+      snapshot.component = &component;
+      snapshot.running = component.running;
+      snapshot.histogram = component.histogram;
+      snapshot.corrected = (component.corrected_histogram != nullptr);
+      if (snapshot.corrected) {
+        snapshot.corrected_histogram = *component.corrected_histogram;
+      }
+      snapshot.counters = component.counter_stats;
+      snapshot.inclusive_ns = component.inclusive_ns;
+      snapshot.exclusive_ns = component.exclusive_ns;
+      snapshot.samples_evicted = component.history.evicted_count();
+      snapshot.raw_offset = raw_count;
+      snapshot.raw_count = include_raw_data ? component.history.size() : 0;
+      raw_count += snapshot.raw_count;
+    });
+
+    if (include_raw_data) {
+      raw_snapshot_.resize(raw_count);
+      for (size_t i = 0; i < snapshot_count; ++i) {
+        const ComponentSnapshot &snapshot = report_snapshots_[i];
+        const SampleHistory &history = snapshot.component->history;
+        for (size_t j = 0; j < snapshot.raw_count; ++j) {
+          raw_snapshot_[snapshot.raw_offset + j] = history.at(j);
+        }
+      }
+    }
+
+    snapshot_span_nodes_locked(report_spans_);
+  }
+
+  // Statistics and raw measurement materialization run per component on
+  // the worker pool, outside the ingest lock
+  report.component_stats.resize(snapshot_count);
+  report.raw_measurements.resize(raw_count);
+  analysis_pool_.parallel_for(snapshot_count, [&](size_t i) {
+    const ComponentSnapshot &snapshot = report_snapshots_[i];
+    PerformanceStatistics &stats = report.component_stats[i];
+    stats.component_name = snapshot.component->name;
+    stats.samples_evicted = snapshot.samples_evicted;
+    stats.counters = snapshot.counters;
+    stats.inclusive_time = std::chrono::nanoseconds{snapshot.inclusive_ns};
+    stats.exclusive_time = std::chrono::nanoseconds{snapshot.exclusive_ns};
+    apply_lifetime_statistics(stats, snapshot.running, snapshot.histogram,
+                              0.999);
+    if (snapshot.corrected) {
+      apply_corrected_statistics(stats, snapshot.corrected_histogram);
+    }
+
+    for (size_t j = 0; j < snapshot.raw_count; ++j) {
+      size_t index = snapshot.raw_offset + j;
+      report.raw_measurements[index] =
+          make_measurement(*snapshot.component, raw_snapshot_[index]);
+    }
+  });
+  report.call_tree = build_call_tree(report_spans_);
+
+  // Calculate overall system utilization score
+  if (!report.component_stats.empty()) {
+    double total_utilization = 0.0;
+    for (const auto &stats : report.component_stats) {
+      // Simple utilization calculation based on deadline compliance
+      double component_utilization = 1.0 - stats.deadline_miss_rate;
+      total_utilization += component_utilization;
+    }
+    report.system_utilization_score =
+        total_utilization / report.component_stats.size();
+  }
+
+  // Add recommendations
+  if (report.overall_timing_compliance) {
+    report.recommendations =
+        "System timing performance is within acceptable limits.";
+  } else {
+    report.recommendations = "Timing violations detected. Review component "
+                             "implementation and constraints.";
+  }
+
+  return report;
+}
+
+std::vector<CallTreeNode> TimingAnalyzerImpl::get_call_tree() {
+  std::vector<SpanSnapshot> snapshots;
+  {
+    std::lock_guard<std::mutex> lock(measurements_mutex_);
+    drain_completed_locked();
+    snapshot_span_nodes_locked(snapshots);
+  }
+  return build_call_tree(snapshots);
+}
+
+bool TimingAnalyzerImpl::start_trace_recording(const std::string &path) {
+  std::lock_guard<std::mutex> lock(measurements_mutex_);
+  drain_completed_locked();
+
+  // Reopening closes the previous recording
+  if (!trace_writer_.open(path)) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Failed to create trace file: " + path);
+    return false;
+  }
+
+  log_message("INFO", "TimingAnalyzer", "Trace recording started: " + path);
+  return true;
+}
+
+void TimingAnalyzerImpl::stop_trace_recording() {
+  std::lock_guard<std::mutex> lock(measurements_mutex_);
+  if (!trace_writer_.is_open()) {
+    return;
+  }
+
+  // Samples completed before the stop belong to the recording
+  drain_completed_locked();
+  uint64_t record_count = trace_writer_.record_count();
+  trace_writer_.close();
+
+  log_message("INFO", "TimingAnalyzer",
+              "Trace recording stopped after " + std::to_string(record_count) +
+                  " samples");
+}
+
+bool TimingAnalyzerImpl::import_trace(const std::string &path,
+                                      const TraceReplayOptions &options) {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  TraceFileReader reader;
+  if (!reader.open(path)) {
+    log_message("ERROR", "TimingAnalyzer", "Failed to read trace file: " + path);
+    return false;
+  }
+
+  // Resolve the file's dictionary and the deadlines to apply before taking
+  // the ingest lock. Ids naming the same component share one target, so
+  // workers only ever touch their own components.
+  constexpr uint32_t kNoTarget = ~uint32_t{0};
+  std::vector<uint32_t> target_of(kTraceDictionaryCapacity, kNoTarget);
+  std::vector<ReplayTarget> targets;
+  std::unordered_map<const ComponentState *, uint32_t> target_index;
+  std::shared_ptr<const ConstraintTable> constraints = load_constraints();
+  for (const auto &entry : reader.components()) {
+    ComponentState *component =
+        component_state(register_component(entry.name));
+    if (component == nullptr) {
+      continue;
+    }
+    auto inserted = target_index.emplace(
+        component, static_cast<uint32_t>(targets.size()));
+    target_of[entry.id] = inserted.first->second;
+    if (!inserted.second) {
+      continue;
+    }
+
+    targets.emplace_back();
+    ReplayTarget &target = targets.back();
+    target.component = component;
+    if (!options.reevaluate_deadlines) {
+      continue;
+    }
+
+    const TimingConstraint *constraint =
+        constraints->find(target.component->id);
+    target.has_deadline = (constraint != nullptr);
+    if (constraint != nullptr) {
+      target.deadline_ns = constraint->deadline.count();
+    }
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+
+  // Partition the records by component in one pass, keeping file order
+  // within a component; records of unnamed components are left out
+  const TraceRecord *records = reader.records();
+  uint64_t record_count = reader.record_count();
+  const size_t target_count = targets.size();
+  std::vector<uint64_t> offsets(target_count + 1, 0);
+  auto target_for = [&](const TraceRecord &record) {
+    return (record.component < kTraceDictionaryCapacity)
+               ? target_of[record.component]
+               : kNoTarget;
+  };
+  for (uint64_t i = 0; i < record_count; ++i) {
+    uint32_t target = target_for(records[i]);
+    if (target != kNoTarget) {
+      ++offsets[target + 1];
+    }
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  uint64_t imported = offsets.back();
+
+  std::vector<TraceRecord> partitioned(imported);
+  {
+    std::vector<uint64_t> next(offsets.begin(), offsets.end() - 1);
+    for (uint64_t i = 0; i < record_count; ++i) {
+      uint32_t target = target_for(records[i]);
+      if (target != kNoTarget) {
+        partitioned[next[target]++] = records[i];
+      }
+    }
+  }
+
+  size_t worker_count = options.worker_threads;
+  if (worker_count == 0) {
+    worker_count = analysis_pool_.concurrency();
+  }
+  worker_count =
+      std::min(worker_count, std::max<size_t>(target_count, 1));
+
+  // Each worker owns a contiguous run of targets holding about an equal
+  // share of the records
+  std::vector<size_t> bounds{0};
+  for (size_t target = 0;
+       target < target_count && bounds.size() < worker_count; ++target) {
+    if (offsets[target + 1] * worker_count >= imported * bounds.size()) {
+      bounds.push_back(target + 1);
+    }
+  }
+  bounds.resize(worker_count + 1, target_count);
+
+  // Order each component's records by start time, judge them against the
+  // deadline and track their jitter without the ingest lock; jitter_mutex
+  // alone guards the tracker
+  auto prepare = [&](size_t worker) {
+    for (size_t t = bounds[worker]; t < bounds[worker + 1]; ++t) {
+      TraceRecord *first = partitioned.data() + offsets[t];
+      TraceRecord *last = partitioned.data() + offsets[t + 1];
+      if (first == last) {
+        continue;
+      }
+      std::sort(first, last, [](const TraceRecord &a, const TraceRecord &b) {
+        return a.start_ns < b.start_ns;
+      });
+
+      const ReplayTarget &target = targets[t];
+      ComponentState &component = *target.component;
+      std::lock_guard<std::mutex> jitter_lock(component.jitter_mutex);
+      for (TraceRecord *record = first; record != last; ++record) {
+        if (target.has_deadline) {
+          record->flags &= ~kTraceFlagDeadlineMet;
+          if (record->execution_ns <= target.deadline_ns) {
+            record->flags |= kTraceFlagDeadlineMet;
+          }
+        }
+        record->jitter_ns =
+            component.jitter.add(to_timing_sample(*record).start_time)
+                .count();
+      }
+      component.last_jitter_ns.store((last - 1)->jitter_ns,
+                                     std::memory_order_relaxed);
+    }
+  };
+
+  // Merge the prepared records into each component's state
+  auto merge = [&](size_t worker) {
+    for (size_t t = bounds[worker]; t < bounds[worker + 1]; ++t) {
+      ComponentState &component = *targets[t].component;
+      for (uint64_t i = offsets[t]; i < offsets[t + 1]; ++i) {
+        TimingSample record = to_timing_sample(partitioned[i]);
+        record.component = component.id;
+        ingest_record_locked(component, record, nullptr, true);
+      }
+    }
+  };
+
+  analysis_pool_.parallel_for(worker_count, prepare);
+  {
+    // Pool threads merge on behalf of this thread, which holds the ingest
+    // lock; partitions beyond the pool's concurrency run in turn
+    std::lock_guard<std::mutex> lock(measurements_mutex_);
+    drain_completed_locked();
+    analysis_pool_.parallel_for(worker_count, merge);
+  }
+  double elapsed_s = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - begin)
+                         .count();
+
+  log_message("INFO", "TimingAnalyzer",
+              "Imported " + std::to_string(imported) + " samples from " + path +
+                  " on " + std::to_string(worker_count) + " threads in " +
+                  std::to_string(elapsed_s) + " s");
+  if (imported < reader.record_count()) {
+    log_message("WARNING", "TimingAnalyzer",
+                std::to_string(reader.record_count() - imported) +
+                    " trace records reference unnamed components");
+  }
+  return true;
+}
+
+void TimingAnalyzerImpl::set_verification_callback(
+    TimingVerificationCallback callback) {
+  std::shared_ptr<const TimingVerificationCallback> installed;
+  if (callback) {
+    installed =
+        std::make_shared<const TimingVerificationCallback>(std::move(callback));
+  }
+
+  std::lock_guard<std::mutex> lock(callback_mutex_);
+  has_verification_callback_.store(installed != nullptr);
+  verification_callback_ = std::move(installed);
+}
+
+void TimingAnalyzerImpl::set_resource_monitoring_callback(
+    ResourceMonitoringCallback callback) {
+  resource_callback_ = std::move(callback);
+}
+
+void TimingAnalyzerImpl::clear_measurements() {
+  std::lock_guard<std::mutex> lock(measurements_mutex_);
+
+  // Discard queued samples and cancel in-flight measurements
+  uint32_t context_count = context_count_.load(std::memory_order_acquire);
+  for (uint32_t i = 0; i < context_count; ++i) {
+    ThreadContext *context = context_table_[i].load(std::memory_order_acquire);
+    context->completed.drain([](const CompletedSample &) {});
+    for (auto &slot : context->slots) {
+      uint64_t state = slot.state.load(std::memory_order_acquire);
+      if ((state & kPhaseMask) == kPhaseActive) {
+        slot.state.compare_exchange_strong(state,
+                                           (state & ~kPhaseMask) | kPhaseFree,
+                                           std::memory_order_acq_rel);
+      }
+    }
+  }
+
+  for_each_component([](ComponentState &component) {
+    component.history.clear();
+    component.running.clear();
+    component.histogram.clear();
+    {
+      std::lock_guard<std::mutex> jitter_lock(component.jitter_mutex);
+      component.jitter.clear();
+    }
+    component.last_jitter_ns.store(0, std::memory_order_relaxed);
+    component.counter_stats = PerformanceCounterStatistics{};
+    component.inclusive_ns = 0;
+    component.exclusive_ns = 0;
+    if (component.corrected_histogram) {
+      component.corrected_histogram->clear();
+    }
+  });
+
+  // Call paths stay registered; only their totals restart
+  uint32_t node_count = span_node_count_.load(std::memory_order_acquire);
+  for (uint32_t i = 0; i < node_count; ++i) {
+    SpanNode *node = span_node_table_[i].load(std::memory_order_acquire);
+    node->calls = 0;
+    node->inclusive_ns = 0;
+    node->exclusive_ns = 0;
+  }
+
+  // Discard queued trace events and the per-point trace logs
+  std::lock_guard<std::mutex> trace_lock(trace_mutex_);
+  for (uint32_t i = 0; i < context_count; ++i) {
+    ThreadContext *context = context_table_[i].load(std::memory_order_acquire);
+    SpscRing<TraceEvent> *ring =
+        context->trace_events.load(std::memory_order_acquire);
+    if (ring != nullptr) {
+      ring->drain([](const TraceEvent &) {});
+    }
+  }
+  for_each_component([](ComponentState &component) {
+    if (component.trace_log) {
+      component.trace_log->clear();
+    }
+  });
+
+  log_message("INFO", "TimingAnalyzer", "All measurement data cleared");
+}
+
+std::chrono::steady_clock::time_point
+TimingAnalyzerImpl::get_precise_timestamp() {
+  return clock_.to_time_point(clock_.now());
+}
+
+bool TimingAnalyzerImpl::set_realtime_priority(bool enable) {
+  if (enable) {
+    return configure_realtime(RealtimeConfig{});
+  }
+
+  RealtimeConfig config;
+  config.policy = SchedulingPolicy::OTHER;
+  config.priority = 0;
+  config.cpus = online_cpus();
+  config.lock_memory = false;
+  config.prefault_stacks = false;
+  return configure_realtime(config);
+}
+
+bool TimingAnalyzerImpl::configure_realtime(const RealtimeConfig &config) {
+  std::unique_lock<std::mutex> lock(realtime_mutex_);
+
+  RealtimeStatus status;
+  status.enabled = (config.policy == SchedulingPolicy::FIFO);
+  status.cpus = config.cpus.empty() ? housekeeping_cpus() : config.cpus;
+  status.scheduling_applied = true;
+  status.affinity_applied = true;
+
+  std::string error;
+  if (config.lock_memory) {
+    status.memory_locked = lock_process_memory(true, error);
+    if (!status.memory_locked) {
+      status.warnings.push_back(error);
+    }
+  } else if (realtime_status_.memory_locked &&
+             !lock_process_memory(false, error)) {
+    status.warnings.push_back(error);
+  }
+
+  realtime_config_ = config;
+  realtime_config_.cpus = status.cpus;
+  realtime_status_ = std::move(status);
+  realtime_enabled_.store(realtime_status_.enabled);
+  uint64_t generation = realtime_generation_.fetch_add(1) + 1;
+
+  // Pool helpers and samplers apply it before their next work; the
+  // dispatcher is woken so the status covers it on return
+  analysis_pool_.set_thread_setup(realtime_thread_setup());
+  if (dispatcher_running_.load()) {
+    dispatch_wakeup_.notify_one();
+    realtime_applied_.wait_for(lock, std::chrono::seconds(1), [&]() {
+      return dispatcher_realtime_generation_ >= generation;
+    });
+  }
+
+  const RealtimeStatus &applied = realtime_status_;
+  bool complete = applied.scheduling_applied && applied.affinity_applied &&
+                  (applied.memory_locked || !config.lock_memory) &&
+                  applied.warnings.empty();
+  if (complete) {
+    log_message("INFO", "TimingAnalyzer",
+                applied.enabled ? "Real-time priority enabled"
+                                : "Real-time priority disabled");
+  } else {
+    for (const auto &warning : applied.warnings) {
+      log_message("WARNING", "TimingAnalyzer",
+                  "Real-time configuration degraded: " + warning);
+    }
+  }
+  return complete;
+}
+
+RealtimeStatus TimingAnalyzerImpl::get_realtime_status() const {
+  std::lock_guard<std::mutex> lock(realtime_mutex_);
+  return realtime_status_;
+}
+
+void TimingAnalyzerImpl::apply_realtime_to_current_thread() {
+  std::lock_guard<std::mutex> lock(realtime_mutex_);
+  if (realtime_generation_.load() == 0) {
+    return; // Never configured; keep inherited settings
+  }
+
+  ThreadSchedulingResult result = apply_thread_scheduling(
+      pthread_self(), realtime_config_, realtime_config_.cpus);
+  if (realtime_config_.prefault_stacks) {
+    prefault_stack(kStackPrefaultBytes);
+  }
+
+  RealtimeStatus &status = realtime_status_;
+  ++status.threads_configured;
+  status.scheduling_applied = status.scheduling_applied && result.scheduling;
+  status.affinity_applied = status.affinity_applied && result.affinity;
+  if (!result.error.empty() &&
+      std::find(status.warnings.begin(), status.warnings.end(),
+                result.error) == status.warnings.end()) {
+    status.warnings.push_back(result.error);
+  }
+}
+
+std::function<void()> TimingAnalyzerImpl::realtime_thread_setup() {
+  return [this]() { apply_realtime_to_current_thread(); };
+}
+
+bool TimingAnalyzerImpl::configure_sampling_rate(double sample_rate) {
+  if (sample_rate <= 0.0 || sample_rate > SamplingEngine::kMaxSampleRate) {
+    return false;
+  }
+
+  sampling_rate_.store(sample_rate);
+  sampling_engine_.set_rate(sample_rate);
+
+  log_message("INFO", "TimingAnalyzer",
+              "Sampling rate configured: " + std::to_string(sample_rate) +
+                  " Hz");
+
+  return true;
+}
+
+ComponentId TimingAnalyzerImpl::register_probe(const std::string &probe_name,
+                                               SamplingProbe probe) {
+  if (!probe) {
+    return INVALID_COMPONENT_ID;
+  }
+
+  ComponentId id = register_component(probe_name);
+  ComponentState *component = component_state(id);
+  if (component == nullptr) {
+    return INVALID_COMPONENT_ID;
+  }
+
+  std::lock_guard<std::mutex> lock(probes_mutex_);
+  auto existing = std::find_if(
+      probes_.begin(), probes_.end(), [&](const RegisteredProbe &entry) {
+        return entry.component == component;
+      });
+  if (existing != probes_.end()) {
+    existing->probe = std::move(probe);
+  } else {
+    probes_.push_back(RegisteredProbe{component, std::move(probe)});
+  }
+  return id;
+}
+
+bool TimingAnalyzerImpl::unregister_probe(ComponentId probe) {
+  std::lock_guard<std::mutex> lock(probes_mutex_);
+  auto existing = std::find_if(
+      probes_.begin(), probes_.end(), [&](const RegisteredProbe &entry) {
+        return entry.component->id == probe;
+      });
+  if (existing == probes_.end()) {
+    return false;
+  }
+  probes_.erase(existing);
+  return true;
+}
+
+bool TimingAnalyzerImpl::start_sampling() {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(sampling_mutex_);
+  if (sampling_engine_.running()) {
+    return true;
+  }
+
+  double sample_rate = sampling_rate_.load();
+  if (!sampling_engine_.start(sample_rate, [this]() { sample_probes(); })) {
+    log_message("ERROR", "TimingAnalyzer", "Failed to start sampling engine");
+    return false;
+  }
+
+  log_message("INFO", "TimingAnalyzer",
+              "Sampling started at " + std::to_string(sample_rate) + " Hz");
+  return true;
+}
+
+void TimingAnalyzerImpl::stop_sampling() {
+  std::lock_guard<std::mutex> lock(sampling_mutex_);
+  sampling_engine_.stop();
+}
+
+SamplingStatistics TimingAnalyzerImpl::get_sampling_statistics() const {
+  SamplingStatistics stats = sampling_engine_.statistics();
+  if (!stats.running) {
+    stats.sample_rate = sampling_rate_.load();
+  }
+  return stats;
+}
+
+void TimingAnalyzerImpl::sample_probes() {
+  // The engine thread picks up real-time changes between ticks
+  uint64_t configured = realtime_generation_.load();
+  if (configured != sampler_realtime_generation_) {
+    sampler_realtime_generation_ = configured;
+    apply_realtime_to_current_thread();
+  }
+
+  ThreadContext *context = local_context();
+  std::lock_guard<std::mutex> lock(probes_mutex_);
+  for (const auto &entry : probes_) {
+    int64_t value = 0;
+    try {
+      value = std::max<int64_t>(entry.probe(), 0);
+    } catch (...) {
+      continue; // A failing probe skips this tick only
+    }
+
+    // The probe value is recorded as the sample's execution time, so the
+    // usual statistics, constraints and violations apply to it
+    const ComponentState &component = *entry.component;
+    uint64_t ticks = clock_.now();
+    TimingSample sample;
+    sample.component = component.id;
+    sample.start_time = clock_.to_time_point(ticks);
+    sample.end_time = sample.start_time;
+    sample.execution_time = std::chrono::nanoseconds{value};
+    sample.jitter = std::chrono::nanoseconds{
+        component.last_jitter_ns.load(std::memory_order_relaxed)};
+
+    uint32_t violation_flags = evaluate_deadline(context, component, sample);
+    if (violation_flags != 0) {
+      queue_violation(context, component, sample, violation_flags);
+    }
+
+    CompletedSample completed{};
+    completed.component = entry.component;
+    completed.start_ticks = ticks;
+    completed.end_ticks = ticks;
+    completed.execution_time = sample.execution_time;
+    completed.self_time = sample.execution_time;
+    completed.deadline_met = sample.deadline_met;
+    enqueue_completed(context, completed);
+  }
+}
+
+bool TimingAnalyzerImpl::enable_performance_counters(bool enable) {
+  if (!enable) {
+    counters_enabled_.store(false);
+    log_message("INFO", "TimingAnalyzer", "Performance counters disabled");
+    return true;
+  }
+
+  // Probe on the calling thread; each measuring thread opens its own group
+  PerfCounterGroup probe;
+  if (!probe.open()) {
+    log_message("WARNING", "TimingAnalyzer",
+                "Performance counters unavailable (perf_event_open failed)");
+    return false;
+  }
+
+  counters_enabled_.store(true);
+  log_message("INFO", "TimingAnalyzer",
+              probe.has_hardware()
+                  ? "Performance counters enabled (hardware and software)"
+                  : "Performance counters enabled (software only; no "
+                    "hardware PMU)");
+  return true;
+}
+
+bool TimingAnalyzerImpl::configure_violation_dispatch(
+    ViolationOverflowPolicy policy) {
+  if (!initialized_.load()) {
+    return false;
+  }
+
+  overflow_policy_.store(policy);
+  return true;
+}
+
+ViolationDispatchStatistics
+TimingAnalyzerImpl::get_violation_dispatch_statistics() const {
+  ViolationDispatchStatistics statistics;
+  statistics.queued = violations_queued_.load();
+  statistics.dispatched = violations_dispatched_.load();
+  statistics.dispatched_inline = violations_inline_.load();
+  statistics.dropped = violations_dropped_.load();
+  statistics.safety_violations = safety_violations_.load();
+  return statistics;
+}
+
+bool TimingAnalyzerImpl::flush_violations(std::chrono::milliseconds timeout) {
+  {
+    // record_ticks() samples are judged when they are ingested
+    std::lock_guard<std::mutex> lock(measurements_mutex_);
+    drain_completed_locked();
+  }
+  uint64_t target = violations_queued_.load();
+
+  std::unique_lock<std::mutex> lock(dispatch_mutex_);
+  if (!dispatcher_running_.load()) {
+    return violations_dispatched_.load() >= target;
+  }
+
+  dispatch_wakeup_.notify_one();
+  return dispatch_progress_.wait_for(lock, timeout, [&]() {
+    return violations_dispatched_.load() >= target;
+  });
+}
+
+// Violation dispatch helpers
+void TimingAnalyzerImpl::start_violation_dispatcher() {
+  if (violation_dispatcher_.joinable()) {
+    return;
+  }
+
+  try {
+    violation_dispatcher_ =
+        std::thread(&TimingAnalyzerImpl::run_violation_dispatcher, this);
+    dispatcher_running_.store(true);
+  } catch (const std::system_error &e) {
+    log_message("WARNING", "TimingAnalyzer",
+                "Violation dispatcher unavailable; dispatching inline: " +
+                    std::string(e.what()));
+  }
+}
+
+void TimingAnalyzerImpl::stop_violation_dispatcher() {
+  if (!violation_dispatcher_.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(dispatch_mutex_);
+    dispatch_stopping_ = true;
+  }
+  dispatch_wakeup_.notify_one();
+  violation_dispatcher_.join();
+  dispatcher_running_.store(false);
+}
+
+void TimingAnalyzerImpl::run_violation_dispatcher() {
+  uint64_t realtime_generation = 0;
+  std::unique_lock<std::mutex> lock(dispatch_mutex_);
+  while (true) {
+    lock.unlock();
+    uint64_t configured = realtime_generation_.load();
+    if (configured != realtime_generation) {
+      realtime_generation = configured;
+      apply_realtime_to_current_thread();
+
+      std::lock_guard<std::mutex> realtime_lock(realtime_mutex_);
+      dispatcher_realtime_generation_ = configured;
+      realtime_applied_.notify_all();
+    }
+    size_t dispatched = dispatch_queued_violations();
+    lock.lock();
+
+    if (dispatched > 0) {
+      dispatch_progress_.notify_all();
+      continue;
+    }
+    if (dispatch_stopping_) {
+      return; // Rings were empty after the stop request
+    }
+
+    // Producers notify without the mutex, so a wakeup can slip in between
+    // this check and the wait; the timeout bounds the resulting delay
+    dispatcher_waiting_.store(true);
+    if (!violations_pending()) {
+      dispatch_wakeup_.wait_for(lock, kViolationDispatchPoll);
+    }
+    dispatcher_waiting_.store(false);
+  }
+}
+
+void TimingAnalyzerImpl::queue_violation(ThreadContext *context,
+                                         const ComponentState &component,
+                                         const TimingSample &sample,
+                                         uint32_t flags) {
+  ViolationRecord record;
+  record.component = &component;
+  record.start_time = sample.start_time;
+  record.execution_ns = sample.execution_time.count();
+  record.jitter_ns = sample.jitter.count();
+  record.flags = flags;
+
+  if (dispatcher_running_.load(std::memory_order_acquire) &&
+      context != nullptr && context->violations.try_push(record)) {
+    violations_queued_.fetch_add(1, std::memory_order_relaxed);
+    if (dispatcher_waiting_.load()) {
+      dispatch_wakeup_.notify_one();
+    }
+    return;
+  }
+
+  // No dispatcher, no thread context or a full ring
+  if (dispatcher_running_.load(std::memory_order_relaxed) &&
+      context != nullptr &&
+      overflow_policy_.load(std::memory_order_relaxed) ==
+          ViolationOverflowPolicy::DROP) {
+    violations_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  violations_inline_.fetch_add(1, std::memory_order_relaxed);
+  dispatch_violation(record);
+}
+
+void TimingAnalyzerImpl::queue_ingest_violation_locked(
+    const ComponentState &component, const TimingSample &sample,
+    uint32_t flags) {
+  ViolationRecord record;
+  record.component = &component;
+  record.start_time = sample.start_time;
+  record.execution_ns = sample.execution_time.count();
+  record.jitter_ns = sample.jitter.count();
+  record.flags = flags;
+
+  // Never dispatched inline: the callback must not run under the ingest
+  // lock, so a full ring drops the record whatever the overflow policy
+  if (!ingest_violations_.try_push(record)) {
+    violations_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  violations_queued_.fetch_add(1, std::memory_order_relaxed);
+  if (dispatcher_waiting_.load()) {
+    dispatch_wakeup_.notify_one();
+  }
+}
+
+size_t TimingAnalyzerImpl::dispatch_queued_violations() {
+  size_t dispatched = 0;
+  uint32_t context_count = context_count_.load(std::memory_order_acquire);
+  for (uint32_t i = 0; i < context_count; ++i) {
+    ThreadContext *context = context_table_[i].load(std::memory_order_acquire);
+    dispatched += context->violations.drain(
+        [this](const ViolationRecord &record) { dispatch_violation(record); });
+  }
+  dispatched += ingest_violations_.drain(
+      [this](const ViolationRecord &record) { dispatch_violation(record); });
+  violations_dispatched_.fetch_add(dispatched);
+  return dispatched;
+}
+
+bool TimingAnalyzerImpl::violations_pending() const {
+  uint32_t context_count = context_count_.load(std::memory_order_acquire);
+  for (uint32_t i = 0; i < context_count; ++i) {
+    ThreadContext *context = context_table_[i].load(std::memory_order_acquire);
+    if (context->violations.size_approx() > 0) {
+      return true;
+    }
+  }
+  return ingest_violations_.size_approx() > 0;
+}
+
+void TimingAnalyzerImpl::dispatch_violation(const ViolationRecord &record) {
+  const ComponentState &component = *record.component;
+
+  TimingSample sample{};
+  sample.component = component.id;
+  sample.start_time = record.start_time;
+  sample.execution_time = std::chrono::nanoseconds(record.execution_ns);
+  sample.end_time = sample.start_time + sample.execution_time;
+  sample.jitter = std::chrono::nanoseconds(record.jitter_ns);
+  sample.deadline_met = (record.flags & kViolationDeadlineMiss) == 0;
+
+  if ((record.flags & kViolationCrossThread) != 0) {
+    log_message("WARNING", "TimingAnalyzer",
+                "Measurement started and stopped on different threads: " +
+                    component.name);
+  }
+  if (!sample.deadline_met) {
+    log_timing_violation(component.name, sample);
+  }
+
+  if ((record.flags & kViolationCheckSafety) == 0) {
+    return;
+  }
+
+  // Checked against the current constraints, which may have been
+  // reconfigured since the sample was queued
+  std::shared_ptr<const ConstraintTable> constraints = load_constraints();
+  const TimingConstraint *constraint = constraints->find(component.id);
+  if (constraint != nullptr &&
+      !check_safety_constraints(component, *constraint, sample)) {
+    safety_violations_.fetch_add(1, std::memory_order_relaxed);
+    log_message("CRITICAL", "TimingAnalyzer",
+                "Safety violation detected for: " + component.name +
+                    " [SAFETY_CRITICAL]");
+  }
+}
+
+// History compaction helpers
+void TimingAnalyzerImpl::start_history_compaction() {
+  std::lock_guard<std::mutex> lock(compaction_mutex_);
+  if (compaction_thread_.joinable()) {
+    return;
+  }
+
+  compaction_stopping_ = false;
+  try {
+    compaction_thread_ =
+        std::thread(&TimingAnalyzerImpl::run_history_compaction, this);
+  } catch (const std::system_error &e) {
+    // Full tiers still roll up their oldest interval on their own
+    log_message("WARNING", "TimingAnalyzer",
+                "History compaction thread not started: " +
+                    std::string(e.what()));
+  }
+}
+
+void TimingAnalyzerImpl::stop_history_compaction() {
+  {
+    std::lock_guard<std::mutex> lock(compaction_mutex_);
+    if (!compaction_thread_.joinable()) {
+      return;
+    }
+    compaction_stopping_ = true;
+  }
+  compaction_wakeup_.notify_all();
+  compaction_thread_.join();
+}
+
+void TimingAnalyzerImpl::run_history_compaction() {
+  uint64_t realtime_generation = 0;
+  std::unique_lock<std::mutex> lock(compaction_mutex_);
+  while (!compaction_stopping_) {
+    lock.unlock();
+    uint64_t configured = realtime_generation_.load();
+    if (configured != realtime_generation) {
+      realtime_generation = configured;
+      apply_realtime_to_current_thread();
+    }
+
+    {
+      std::lock_guard<std::mutex> measurements_lock(measurements_mutex_);
+      for_each_component([](ComponentState &component) {
+        if (component.history.tiers().enabled()) {
+          component.history.compact();
+        }
+      });
+    }
+
+    lock.lock();
+    compaction_wakeup_.wait_for(lock, kHistoryCompactionPeriod,
+                                [this]() { return compaction_stopping_; });
+  }
+}
+
+// Sample ingest helpers
+void TimingAnalyzerImpl::start_sample_ingest() {
+  std::lock_guard<std::mutex> lock(ingest_mutex_);
+  if (ingest_thread_.joinable()) {
+    return;
+  }
+
+  ingest_stopping_ = false;
+  try {
+    ingest_thread_ = std::thread(&TimingAnalyzerImpl::run_sample_ingest, this);
+  } catch (const std::system_error &e) {
+    // Queries still drain the rings; between them full rings drop samples
+    log_message("WARNING", "TimingAnalyzer",
+                "Sample ingest thread not started: " + std::string(e.what()));
+  }
+}
+
+void TimingAnalyzerImpl::stop_sample_ingest() {
+  {
+    std::lock_guard<std::mutex> lock(ingest_mutex_);
+    if (!ingest_thread_.joinable()) {
+      return;
+    }
+    ingest_stopping_ = true;
+  }
+  ingest_wakeup_.notify_all();
+  ingest_thread_.join();
+}
+
+void TimingAnalyzerImpl::run_sample_ingest() {
+  uint64_t realtime_generation = 0;
+  uint64_t reported_rejected = 0;
+  uint64_t reported_dropped = 0;
+  auto next_report = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> lock(ingest_mutex_);
+  while (!ingest_stopping_) {
+    lock.unlock();
+    uint64_t configured = realtime_generation_.load();
+    if (configured != realtime_generation) {
+      realtime_generation = configured;
+      apply_realtime_to_current_thread();
+    }
+
+    {
+      std::lock_guard<std::mutex> measurements_lock(measurements_mutex_);
+      drain_completed_locked();
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (now >= next_report) {
+      report_measurement_losses(reported_rejected, reported_dropped);
+      next_report = now + kLossReportPeriod;
+    }
+
+    // Producers notify without the mutex, so a wakeup can slip in between
+    // here and the wait; the timeout bounds the resulting delay
+    lock.lock();
+    if (ingest_stopping_) {
+      break;
+    }
+    ingest_waiting_.store(true);
+    ingest_wakeup_.wait_for(lock, kIngestPoll);
+    ingest_waiting_.store(false);
+  }
+}
+
+void TimingAnalyzerImpl::report_measurement_losses(
+    uint64_t &reported_rejected, uint64_t &reported_dropped) {
+  uint64_t rejected = starts_rejected_.load();
+  if (rejected != reported_rejected) {
+    log_message("WARNING", "TimingAnalyzer",
+                std::to_string(rejected - reported_rejected) +
+                    " measurement starts rejected: no free slot");
+    reported_rejected = rejected;
+  }
+
+  uint64_t dropped = samples_dropped_.load();
+  if (dropped != reported_dropped) {
+    log_message("WARNING", "TimingAnalyzer",
+                std::to_string(dropped - reported_dropped) +
+                    " completed samples dropped: completion buffer full");
+    reported_dropped = dropped;
+  }
+}
+
+// Shared-memory collection
+bool TimingAnalyzerImpl::start_shared_collector(
+    const std::string &segment_name, const SharedMemoryConfig &config) {
+  if (!initialized_.load()) {
+    return false;
+  }
+  if (config.producer_capacity == 0 ||
+      config.producer_capacity > kMaxSharedProducers ||
+      config.ring_capacity == 0 || config.ring_capacity > kMaxSharedRing) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Invalid shared memory segment size");
+    return false;
+  }
+
+  stop_shared_collector();
+
+  std::lock_guard<std::mutex> control(shared_control_mutex_);
+  uint32_t producer_capacity =
+      static_cast<uint32_t>(config.producer_capacity);
+  if (!shared_collector_.create(segment_name, producer_capacity,
+                                static_cast<uint32_t>(config.ring_capacity))) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Failed to create shared memory segment: " + segment_name);
+    return false;
+  }
+
+  shared_collector_config_ = config;
+  collected_producers_.assign(producer_capacity, CollectedProducer{});
+  producers_active_.store(0);
+  producers_attached_.store(0);
+  producers_lost_.store(0);
+  records_collected_.store(0);
+  records_dropped_.store(0);
+  {
+    std::lock_guard<std::mutex> lock(shared_wait_mutex_);
+    shared_collector_stopping_ = false;
+  }
+  try {
+    shared_collector_thread_ =
+        std::thread(&TimingAnalyzerImpl::run_shared_collector, this);
+    shared_collecting_.store(true);
+  } catch (const std::system_error &e) {
+    shared_collector_.close();
+    log_message("ERROR", "TimingAnalyzer",
+                "Failed to start shared memory collector: " +
+                    std::string(e.what()));
+    return false;
+  }
+
+  log_message("INFO", "TimingAnalyzer",
+              "Shared memory collector started: " + segment_name);
+  return true;
+}
+
+void TimingAnalyzerImpl::stop_shared_collector() {
+  std::lock_guard<std::mutex> control(shared_control_mutex_);
+  if (!shared_collector_thread_.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(shared_wait_mutex_);
+    shared_collector_stopping_ = true;
+  }
+  shared_wakeup_.notify_all();
+  shared_collector_thread_.join();
+  shared_collecting_.store(false);
+  shared_collector_.close();
+  producers_active_.store(0);
+
+  log_message("INFO", "TimingAnalyzer",
+              "Shared memory collector stopped after " +
+                  std::to_string(records_collected_.load()) + " records");
+}
+
+bool TimingAnalyzerImpl::start_shared_export(
+    const std::string &segment_name, const std::string &process_label,
+    const SharedMemoryConfig &config) {
+  if (!initialized_.load() || segment_name.empty()) {
+    return false;
+  }
+
+  stop_shared_export();
+
+  std::lock_guard<std::mutex> control(shared_control_mutex_);
+  shared_export_config_ = config;
+  shared_export_segment_ = segment_name;
+  shared_export_label_ = process_label;
+  records_exported_.store(0);
+  export_dropped_.store(0);
+  {
+    // Attach right away when a collector is up, so every sample ingested
+    // from here on reaches it
+    std::lock_guard<std::mutex> lock(measurements_mutex_);
+    drain_completed_locked();
+    attach_shared_export_locked();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(shared_wait_mutex_);
+    shared_export_stopping_ = false;
+  }
+  try {
+    shared_export_thread_ =
+        std::thread(&TimingAnalyzerImpl::run_shared_export, this);
+    shared_exporting_.store(true);
+  } catch (const std::system_error &e) {
+    std::lock_guard<std::mutex> lock(measurements_mutex_);
+    shared_producer_.detach();
+    export_attached_.store(false);
+    log_message("ERROR", "TimingAnalyzer",
+                "Failed to start shared memory export: " +
+                    std::string(e.what()));
+    return false;
+  }
+  return true;
+}
+
+void TimingAnalyzerImpl::stop_shared_export() {
+  std::lock_guard<std::mutex> control(shared_control_mutex_);
+  if (!shared_export_thread_.joinable()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(shared_wait_mutex_);
+    shared_export_stopping_ = true;
+  }
+  shared_wakeup_.notify_all();
+  shared_export_thread_.join();
+  shared_exporting_.store(false);
+
+  // Samples completed before the stop still reach the collector
+  std::lock_guard<std::mutex> lock(measurements_mutex_);
+  drain_completed_locked();
+  shared_producer_.detach();
+  export_attached_.store(false);
+}
+
+SharedMemoryStatistics
+TimingAnalyzerImpl::get_shared_memory_statistics() const {
+  SharedMemoryStatistics stats;
+  stats.collecting = shared_collecting_.load();
+  stats.producers_active = producers_active_.load();
+  stats.producers_attached = producers_attached_.load();
+  stats.producers_lost = producers_lost_.load();
+  stats.records_collected = records_collected_.load();
+  stats.records_dropped = records_dropped_.load();
+  stats.exporting = shared_exporting_.load();
+  stats.export_attached = export_attached_.load();
+  stats.records_exported = records_exported_.load();
+  stats.export_dropped = export_dropped_.load();
+  return stats;
+}
+
+// Shared-memory helpers
+void TimingAnalyzerImpl::run_shared_collector() {
+  uint64_t realtime_generation = 0;
+  std::unique_lock<std::mutex> lock(shared_wait_mutex_);
+  while (!shared_collector_stopping_) {
+    lock.unlock();
+    uint64_t configured = realtime_generation_.load();
+    if (configured != realtime_generation) {
+      realtime_generation = configured;
+      apply_realtime_to_current_thread();
+    }
+    collect_shared_records();
+
+    lock.lock();
+    shared_wakeup_.wait_for(lock, shared_collector_config_.poll_interval,
+                            [this]() { return shared_collector_stopping_; });
+  }
+  lock.unlock();
+
+  // Records queued before the stop are still ingested
+  collect_shared_records();
+}
+
+void TimingAnalyzerImpl::collect_shared_records() {
+  using SlotState = SharedTimingCollector::SlotState;
+
+  shared_collector_.heartbeat();
+  int64_t local_offset_ns = steady_to_realtime_offset_ns();
+  int64_t now_ns = realtime_ns();
+  int64_t timeout_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           shared_collector_config_.liveness_timeout)
+                           .count();
+  std::shared_ptr<const ConstraintTable> constraints = load_constraints();
+  std::vector<SharedTimingCollector::Component> named;
+
+  size_t active = 0;
+  for (uint32_t slot = 0; slot < shared_collector_.producer_capacity();
+       ++slot) {
+    SharedTimingCollector::ProducerInfo info = shared_collector_.producer(slot);
+    if (info.state != SlotState::ACTIVE && info.state != SlotState::DETACHED) {
+      continue;
+    }
+
+    CollectedProducer &producer = collected_producers_[slot];
+    std::string identity =
+        info.label + " (pid " + std::to_string(info.pid) + ")";
+    if (!producer.attached || producer.generation != info.generation) {
+      producer = CollectedProducer{};
+      producer.attached = true;
+      producer.generation = info.generation;
+      producers_attached_.fetch_add(1);
+      log_message("INFO", "TimingAnalyzer",
+                  "Timing producer attached: " + identity);
+    }
+
+    // The tail is read before the dictionary, so every name its records use
+    // is visible; registering takes the registry lock, not the ingest lock
+    uint64_t tail = shared_collector_.tail(slot);
+    named.clear();
+    shared_collector_.read_components(slot, producer.next_index, named);
+    for (const auto &component : named) {
+      if (component.index >= producer.components.size()) {
+        producer.components.resize(component.index + 1, nullptr);
+      }
+      producer.components[component.index] =
+          component_state(register_component(component.name));
+    }
+
+    bool dead = info.state == SlotState::ACTIVE &&
+                (process_exited(info.pid) ||
+                 now_ns - info.heartbeat_ns > timeout_ns);
+
+    // Records carry the producer's steady clock; the realtime offsets both
+    // sides publish move them into ours
+    using Duration = std::chrono::steady_clock::duration;
+    auto shift = std::chrono::duration_cast<Duration>(
+        std::chrono::nanoseconds(info.clock_offset_ns - local_offset_ns));
+    uint64_t collected = 0;
+    {
+      std::lock_guard<std::mutex> lock(measurements_mutex_);
+      collected = shared_collector_.drain(
+          slot, tail, [&](const TraceRecord &source) {
+            size_t index = source.component - 1;
+            if (source.component == INVALID_COMPONENT_ID ||
+                index >= producer.components.size() ||
+                producer.components[index] == nullptr) {
+              return;
+            }
+
+            ComponentState &component = *producer.components[index];
+            TimingSample record = to_timing_sample(source);
+            record.component = component.id;
+            record.start_time += shift;
+            record.end_time += shift;
+            uint32_t violation_flags =
+                evaluate_deadline(*constraints, component, record);
+            ingest_record_locked(component, record, nullptr);
+            if (violation_flags != 0) {
+              // Dispatched like a local stop's violation
+              queue_ingest_violation_locked(component, record,
+                                            violation_flags);
+            }
+            if (trace_writer_.is_open()) {
+              write_trace_record_locked(component, record);
+            }
+          });
+    }
+    records_collected_.fetch_add(collected);
+    records_dropped_.fetch_add(info.dropped - producer.dropped);
+    producer.dropped = info.dropped;
+
+    if (info.state == SlotState::DETACHED || dead) {
+      shared_collector_.release(slot);
+      producer.attached = false;
+      if (dead) {
+        producers_lost_.fetch_add(1);
+        log_message("WARNING", "TimingAnalyzer",
+                    "Timing producer lost: " + identity);
+      } else {
+        log_message("INFO", "TimingAnalyzer",
+                    "Timing producer detached: " + identity);
+      }
+      continue;
+    }
+    ++active;
+  }
+  producers_active_.store(active);
+}
+
+void TimingAnalyzerImpl::run_shared_export() {
+  uint64_t realtime_generation = 0;
+  std::unique_lock<std::mutex> lock(shared_wait_mutex_);
+  while (!shared_export_stopping_) {
+    lock.unlock();
+    uint64_t configured = realtime_generation_.load();
+    if (configured != realtime_generation) {
+      realtime_generation = configured;
+      apply_realtime_to_current_thread();
+    }
 
-  auto it = active_measurements_.find(measurement_id);
-  if (it == active_measurements_.end()) {
-    result.task_name = "NOT_FOUND";
-    return result;
+    {
+      // Reattach before draining so completed samples reach a live collector
+      std::lock_guard<std::mutex> measurements_lock(measurements_mutex_);
+      if (!shared_producer_.is_connected(
+              shared_export_config_.liveness_timeout)) {
+        attach_shared_export_locked();
+      }
+      drain_completed_locked();
+      shared_producer_.heartbeat();
+    }
+
+    lock.lock();
+    shared_wakeup_.wait_for(lock, shared_export_config_.poll_interval,
+                            [this]() { return shared_export_stopping_; });
   }
+}
 
-  const auto &active = it->second;
-  result.task_name = active.component_name;
-  result.start_time = active.start_time;
-  result.execution_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
-      end_time - active.start_time);
+bool TimingAnalyzerImpl::attach_shared_export_locked() {
+  bool was_attached = export_attached_.load();
+  shared_producer_.detach();
+  shared_export_ids_.clear();
+  shared_export_defined_ = 0;
 
-  // Check if this thread matches the starting thread
-  if (std::this_thread::get_id() != active.thread_id) {
+  bool attached =
+      shared_producer_.attach(shared_export_segment_, shared_export_label_);
+  export_attached_.store(attached);
+  if (attached && !was_attached) {
+    log_message("INFO", "TimingAnalyzer",
+                "Exporting timing samples to " + shared_export_segment_);
+  } else if (!attached && was_attached) {
     log_message("WARNING", "TimingAnalyzer",
-                "Measurement started and stopped on different threads: " +
-                    active.component_name);
+                "Timing collector gone, samples stay local: " +
+                    shared_export_segment_);
   }
+  return attached;
+}
 
-  // Calculate jitter if we have historical data
-  {
-    auto hist_it = measurement_history_.find(active.component_name);
-    if (hist_it != measurement_history_.end() && !hist_it->second.empty()) {
-      result.jitter = calculate_jitter(hist_it->second);
-    }
+void TimingAnalyzerImpl::export_shared_record_locked(
+    const ComponentState &component, const TimingSample &record) {
+  if (component.id >= shared_export_ids_.size()) {
+    shared_export_ids_.resize(component.id + 1, 0);
   }
 
-  // Check deadline compliance
-  {
-    std::lock_guard<std::mutex> constraints_lock(constraints_mutex_);
-    auto constraint_it = constraints_.find(active.component_name);
-    if (constraint_it != constraints_.end()) {
-      const auto &constraint = constraint_it->second;
-      result.deadline_met = (result.execution_time <= constraint.deadline);
-
-      if (!result.deadline_met) {
-        log_timing_violation(active.component_name, result);
-      }
+  // A component is named in the segment with its first exported sample
+  uint32_t &entry = shared_export_ids_[component.id];
+  if (entry == 0) {
+    if (!shared_producer_.define_component(shared_export_defined_,
+                                           component.name)) {
+      export_dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
     }
+    entry = ++shared_export_defined_;
   }
 
-  // Check safety constraints
-  if (!check_safety_constraints(result)) {
-    log_message("CRITICAL", "TimingAnalyzer",
-                "Safety violation detected for: " + active.component_name +
-                    " [SAFETY_CRITICAL]");
+  TraceRecord shared = make_trace_record(record);
+  shared.component = entry;
+  if (shared_producer_.append(shared)) {
+    records_exported_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    export_dropped_.fetch_add(1, std::memory_order_relaxed);
   }
+}
 
-  // Store measurement in history
-  measurement_history_[active.component_name].push_back(result);
+// Measurement path helpers
+TimingAnalyzerImpl::ThreadContext *TimingAnalyzerImpl::local_context() {
+  ThreadBindings &bindings = thread_bindings_;
+  if (bindings.last_serial == instance_serial()) {
+    return bindings.last_context;
+  }
 
-  // Remove from active measurements
-  active_measurements_.erase(it);
+  ThreadContext *context = nullptr;
+  for (const auto &binding : bindings.entries) {
+    if (binding.analyzer_serial == instance_serial()) {
+      context = binding.context.get();
+      break;
+    }
+  }
+  if (context == nullptr) {
+    context = bind_thread_context();
+    if (context == nullptr) {
+      return nullptr;
+    }
+  }
 
-  return result;
+  bindings.last_serial = instance_serial();
+  bindings.last_context = context;
+  return context;
 }
 
-PerformanceStatistics TimingAnalyzerImpl::analyze_deadline_compliance(
-    const std::string &component_name,
-    std::chrono::nanoseconds analysis_window) {
-
-  std::lock_guard<std::mutex> lock(measurements_mutex_);
-
-  auto it = measurement_history_.find(component_name);
-  if (it == measurement_history_.end()) {
-    return PerformanceStatistics{component_name, 0};
+TimingAnalyzerImpl::ThreadContext *TimingAnalyzerImpl::bind_thread_context() {
+  auto &entries = thread_bindings_.entries;
+
+  // Drop bindings to analyzers that no longer exist
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [](const ThreadBinding &binding) {
+                                 return !binding.context->analyzer_alive.load(
+                                     std::memory_order_acquire);
+                               }),
+                entries.end());
+
+  std::lock_guard<std::mutex> lock(contexts_mutex_);
+
+  // Reuse a context released by an exited thread before growing the table
+  std::shared_ptr<ThreadContext> context;
+  for (const auto &candidate : thread_contexts_) {
+    if (!candidate->in_use.load(std::memory_order_acquire)) {
+      context = candidate;
+      context->in_use.store(true, std::memory_order_relaxed);
+
+      // Counters of the exited thread cannot be reused by this one, nor
+      // can the spans it left in flight enclose this thread's spans
+      context->counters.close();
+      context->counters_failed = false;
+      context->span_stack.clear();
+      break;
+    }
   }
 
-  // Filter measurements within the analysis window
-  auto now = std::chrono::steady_clock::now();
-  auto cutoff_time = now - analysis_window;
-
-  std::vector<TimingMeasurement> filtered_measurements;
-  for (const auto &measurement : it->second) {
-    if (measurement.start_time >= cutoff_time) {
-      filtered_measurements.push_back(measurement);
+  if (!context) {
+    auto index = static_cast<uint32_t>(thread_contexts_.size());
+    if (index >= kMaxThreadContexts) {
+      log_message("ERROR", "TimingAnalyzer",
+                  "Thread context limit reached; measurement rejected");
+      return nullptr;
     }
+    context = std::make_shared<ThreadContext>(index);
+    thread_contexts_.push_back(context);
+    context_table_[index].store(context.get(), std::memory_order_release);
+    context_count_.store(index + 1, std::memory_order_release);
   }
 
-  return calculate_statistics(component_name, filtered_measurements);
+  entries.push_back(ThreadBinding{instance_serial(), context});
+  return context.get();
 }
 
-PerformanceStatistics
-TimingAnalyzerImpl::measure_jitter(const std::string &component_name,
-                                   size_t sample_count) {
+TimingAnalyzerImpl::ComponentState *
+TimingAnalyzerImpl::find_component(const std::string &component_name) const {
+  std::shared_lock<std::shared_mutex> lock(components_mutex_);
+  auto it = component_ids_.find(component_name);
+  return (it != component_ids_.end()) ? component_state(it->second) : nullptr;
+}
 
-  std::lock_guard<std::mutex> lock(measurements_mutex_);
+TimingAnalyzerImpl::ComponentState *
+TimingAnalyzerImpl::component_state(ComponentId component) const noexcept {
+  if (component == INVALID_COMPONENT_ID ||
+      component >= component_count_.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  return component_table_[component].load(std::memory_order_acquire);
+}
 
-  auto it = measurement_history_.find(component_name);
-  if (it == measurement_history_.end()) {
-    return PerformanceStatistics{component_name, 0};
+template <typename Visitor>
+void TimingAnalyzerImpl::for_each_component(Visitor &&visitor) const {
+  uint32_t count = component_count_.load(std::memory_order_acquire);
+  for (ComponentId id = 1; id < count; ++id) {
+    visitor(*component_table_[id].load(std::memory_order_acquire));
   }
+}
 
-  // Take the last N measurements for jitter analysis
-  const auto &all_measurements = it->second;
-  size_t start_idx = (all_measurements.size() > sample_count)
-                         ? all_measurements.size() - sample_count
-                         : 0;
+bool TimingAnalyzerImpl::complete_measurement(uint64_t measurement_id,
+                                              uint64_t end_ticks,
+                                              CompletedSample &sample) {
+  auto slot_index =
+      static_cast<uint32_t>(measurement_id & ((1u << kSlotBits) - 1));
+  auto context_index = static_cast<uint32_t>(
+      (measurement_id >> kSlotBits) & ((1u << kThreadBits) - 1));
+  uint64_t generation = measurement_id >> (kSlotBits + kThreadBits);
 
-  std::vector<TimingMeasurement> jitter_samples(
-      all_measurements.begin() + start_idx, all_measurements.end());
+  if (context_index >= context_count_.load(std::memory_order_acquire)) {
+    return false;
+  }
 
-  auto stats = calculate_statistics(component_name, jitter_samples);
+  ThreadContext *context =
+      context_table_[context_index].load(std::memory_order_acquire);
+  ActiveSlot &slot = context->slots[slot_index];
 
-  // Calculate jitter-specific metrics
-  if (!jitter_samples.empty()) {
-    stats.jitter_coefficient =
-        static_cast<double>(stats.std_deviation.count()) /
-        static_cast<double>(stats.avg_execution_time.count());
+  // Claim the slot so a concurrent stop with the same ID cannot race us
+  const uint64_t active_state = (generation << kPhaseBits) | kPhaseActive;
+  uint64_t expected = active_state;
+  if (!slot.state.compare_exchange_strong(
+          expected, (generation << kPhaseBits) | kPhaseStopping,
+          std::memory_order_acq_rel)) {
+    return false;
   }
 
-  return stats;
-}
+  sample.component = slot.component;
+  sample.start_ticks = slot.start_ticks;
+  sample.end_ticks = end_ticks;
+  sample.span = slot.span;
+  sample.parent = slot.parent;
+  sample.child_ticks = slot.child_ticks.load(std::memory_order_relaxed);
+  uint32_t parent_slot = slot.parent_slot;
+  uint64_t parent_state = slot.parent_state;
+  std::thread::id start_thread = slot.thread_id;
+
+  // Counters belong to the starting thread; only it can read the end values
+  PerfCounterGroup::Reading end_counters;
+  if (slot.has_counters && std::this_thread::get_id() == start_thread &&
+      context->counters.read(end_counters)) {
+    context->counters.delta(slot.start_counters, end_counters,
+                            sample.counters);
+  }
 
-PerformanceStatistics
-TimingAnalyzerImpl::profile_latency(const std::string &start_point,
-                                    const std::string &end_point,
-                                    size_t sample_count) {
+  slot.state.store((generation << kPhaseBits) | kPhaseFree,
+                   std::memory_order_release);
+
+  // The span stack belongs to the starting thread. A span stopped on
+  // another thread leaves a stale entry there, dropped on the next start,
+  // and is not subtracted from its enclosing span.
+  if (std::this_thread::get_id() == start_thread) {
+    pop_span(*context, slot_index, active_state);
+    if (parent_slot != kNoParentSlot) {
+      ActiveSlot &parent = context->slots[parent_slot];
+      if (parent.state.load(std::memory_order_acquire) == parent_state) {
+        parent.child_ticks.fetch_add(
+            (end_ticks > sample.start_ticks) ? end_ticks - sample.start_ticks
+                                             : 0,
+            std::memory_order_relaxed);
+      }
+    }
+  }
 
-  // This is a simplified implementation
-  // In practice, this would coordinate measurements between start and end
-  // points
-  return PerformanceStatistics{start_point + "_to_" + end_point, 0};
+  sample.cross_thread = (std::this_thread::get_id() != start_thread);
+  return true;
 }
 
-ResourceUtilization TimingAnalyzerImpl::monitor_resource_utilization(
-    const std::string &resource_name,
-    std::chrono::nanoseconds monitoring_duration) {
+TimingAnalyzerImpl::SpanFrame *
+TimingAnalyzerImpl::innermost_span(ThreadContext &context) noexcept {
+  // Entries of spans stopped on another thread or cancelled by
+  // clear_measurements() no longer match their slot's state
+  auto &stack = context.span_stack;
+  while (!stack.empty()) {
+    SpanFrame &top = stack.back();
+    if (context.slots[top.slot_index].state.load(std::memory_order_acquire) ==
+        top.state) {
+      return &top;
+    }
+    stack.pop_back();
+  }
+  return nullptr;
+}
 
-  ResourceUtilization result{};
-  result.resource_name = resource_name;
-  result.measurement_window = monitoring_duration;
+void TimingAnalyzerImpl::pop_span(ThreadContext &context, uint32_t slot_index,
+                                  uint64_t state) noexcept {
+  // Normally the innermost entry; spans stopped out of order sit below it
+  auto &stack = context.span_stack;
+  for (size_t i = stack.size(); i-- > 0;) {
+    if (stack[i].slot_index == slot_index && stack[i].state == state) {
+      stack.erase(stack.begin() + static_cast<std::ptrdiff_t>(i));
+      return;
+    }
+  }
+}
 
-  if (resource_callback_) {
-    result = resource_callback_(resource_name);
-  } else {
-    // Default implementation - simulate some utilization data
-    result.average_utilization = 45.0; // 45% average
-    result.peak_utilization = 78.0;    // 78% peak
-    result.exceeds_safety_threshold = (result.peak_utilization > 85.0);
+TimingAnalyzerImpl::SpanNode *
+TimingAnalyzerImpl::resolve_span_node(ThreadContext &context,
+                                      const SpanNode *parent,
+                                      ComponentState *component) {
+  uint64_t key =
+      (uint64_t{(parent != nullptr) ? parent->index + 1 : 0} << 32) |
+      component->id;
+  if (key == context.last_span_key) {
+    return context.last_span_node; // A scope timed in a loop
+  }
+  auto cached = context.span_node_cache.find(key);
+  if (cached != context.span_node_cache.end()) {
+    context.last_span_key = key;
+    context.last_span_node = cached->second;
+    return cached->second;
   }
 
-  return result;
+  SpanNode *node = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(span_nodes_mutex_);
+    auto it = span_node_ids_.find(key);
+    if (it != span_node_ids_.end()) {
+      node = it->second;
+    } else {
+      auto index = static_cast<uint32_t>(span_node_storage_.size());
+      if (index < kMaxSpanNodes) {
+        bool recursive = false;
+        for (const SpanNode *ancestor = parent; ancestor != nullptr;
+             ancestor = ancestor->parent) {
+          recursive = recursive || (ancestor->component == component);
+        }
+        span_node_storage_.push_back(
+            std::make_unique<SpanNode>(index, parent, component, recursive));
+        node = span_node_storage_.back().get();
+        span_node_table_[index].store(node, std::memory_order_release);
+        span_node_count_.store(index + 1, std::memory_order_release);
+      } else if (span_node_ids_.size() == kMaxSpanNodes) {
+        log_message("WARNING", "TimingAnalyzer",
+                    "Span call path limit reached; further paths are left "
+                    "out of the call tree");
+      }
+      // Untracked paths are remembered too, so the limit is paid once
+      span_node_ids_.emplace(key, node);
+    }
+  }
+
+  context.span_node_cache.emplace(key, node);
+  context.last_span_key = key;
+  context.last_span_node = node;
+  return node;
 }
 
-PerformanceStatistics
-TimingAnalyzerImpl::estimate_wcet(const std::string &component_name,
-                                  double confidence_level) {
+void TimingAnalyzerImpl::snapshot_span_nodes_locked(
+    std::vector<SpanSnapshot> &snapshots) {
+  uint32_t node_count = span_node_count_.load(std::memory_order_acquire);
+  snapshots.resize(node_count);
+  for (uint32_t i = 0; i < node_count; ++i) {
+    const SpanNode *node = span_node_table_[i].load(std::memory_order_acquire);
+    snapshots[i] = SpanSnapshot{node, node->calls, node->inclusive_ns,
+                                node->exclusive_ns};
+  }
+}
 
-  std::lock_guard<std::mutex> lock(measurements_mutex_);
+std::vector<CallTreeNode> TimingAnalyzerImpl::build_call_tree(
+    const std::vector<SpanSnapshot> &snapshots) const {
+  // Nodes are created after their parent, so a reverse pass marks every
+  // path leading to recorded spans; paths still in flight have no calls
+  // of their own but must stay to connect their children
+  size_t count = snapshots.size();
+  std::vector<bool> reachable(count, false);
+  for (size_t i = count; i-- > 0;) {
+    const SpanNode *parent = snapshots[i].node->parent;
+    reachable[i] = reachable[i] || snapshots[i].calls > 0;
+    if (reachable[i] && parent != nullptr) {
+      reachable[parent->index] = true;
+    }
+  }
 
-  auto it = measurement_history_.find(component_name);
-  if (it == measurement_history_.end()) {
-    return PerformanceStatistics{component_name, 0};
+  // children[count] lists the top-level paths
+  std::vector<std::vector<size_t>> children(count + 1);
+  for (size_t i = 0; i < count; ++i) {
+    if (reachable[i]) {
+      const SpanNode *parent = snapshots[i].node->parent;
+      children[(parent != nullptr) ? parent->index : count].push_back(i);
+    }
+  }
+  for (auto &siblings : children) {
+    std::sort(siblings.begin(), siblings.end(), [&](size_t a, size_t b) {
+      return snapshots[a].inclusive_ns > snapshots[b].inclusive_ns;
+    });
   }
 
-  auto stats = calculate_statistics(component_name, it->second);
+  // Depth-first with an explicit stack of (node, parent entry)
+  std::vector<CallTreeNode> tree;
+  std::vector<std::pair<size_t, std::ptrdiff_t>> pending;
+  auto push_children = [&](size_t list, std::ptrdiff_t parent_entry) {
+    const auto &siblings = children[list];
+    for (auto it = siblings.rbegin(); it != siblings.rend(); ++it) {
+      pending.emplace_back(*it, parent_entry);
+    }
+  };
 
-  // Simple WCET estimation using statistical approach
-  if (!it->second.empty()) {
-    std::vector<std::chrono::nanoseconds> execution_times;
-    for (const auto &measurement : it->second) {
-      execution_times.push_back(measurement.execution_time);
+  push_children(count, -1);
+  while (!pending.empty()) {
+    auto [index, parent_entry] = pending.back();
+    pending.pop_back();
+
+    const SpanSnapshot &snapshot = snapshots[index];
+    CallTreeNode entry;
+    entry.component_name = snapshot.node->component->name;
+    entry.path = entry.component_name;
+    entry.parent_index = parent_entry;
+    if (parent_entry >= 0) {
+      const CallTreeNode &parent = tree[static_cast<size_t>(parent_entry)];
+      entry.path = parent.path + "/" + entry.component_name;
+      entry.depth = parent.depth + 1;
     }
+    entry.calls = snapshot.calls;
+    entry.inclusive_time = std::chrono::nanoseconds{snapshot.inclusive_ns};
+    entry.exclusive_time = std::chrono::nanoseconds{snapshot.exclusive_ns};
+    tree.push_back(std::move(entry));
 
-    // Use high percentile as WCET estimate
-    stats.wcet_estimate =
-        TimingUtils::calculate_percentile(execution_times, confidence_level);
+    push_children(index, static_cast<std::ptrdiff_t>(tree.size() - 1));
   }
-
-  return stats;
+  return tree;
 }
 
-bool TimingAnalyzerImpl::verify_timing_constraints() {
-  std::lock_guard<std::mutex> constraints_lock(constraints_mutex_);
-  std::lock_guard<std::mutex> measurements_lock(measurements_mutex_);
+void TimingAnalyzerImpl::enqueue_completed(ThreadContext *context,
+                                           const CompletedSample &sample) {
+  // The measuring thread never takes the ingest lock: without a context, or
+  // with the ring full because the ingest thread has fallen behind, the
+  // sample is dropped and counted
+  if (context == nullptr || !context->completed.try_push(sample)) {
+    samples_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
 
-  bool all_constraints_met = true;
+  if (context->completed.size_approx() >= kCompletedRingHighWater &&
+      ingest_waiting_.load(std::memory_order_relaxed)) {
+    ingest_wakeup_.notify_one();
+  }
+}
 
-  for (const auto &[component_name, constraint] : constraints_) {
-    auto it = measurement_history_.find(component_name);
-    if (it == measurement_history_.end()) {
-      continue; // No measurements for this component
-    }
+void TimingAnalyzerImpl::drain_completed_locked() {
+  // Queued ticks are converted at ingest with the current calibration
+  clock_.recalibrate_if_due();
+
+  // Each ring holds one thread's samples in completion order; a component
+  // measured from several threads gets them merged by start tick, so its
+  // history stays in start-time order. Room is reserved before a ring is
+  // consumed, so a failed allocation leaves the samples queued.
+  drain_batch_.clear();
+  uint32_t context_count = context_count_.load(std::memory_order_acquire);
+  for (uint32_t i = 0; i < context_count; ++i) {
+    ThreadContext *context = context_table_[i].load(std::memory_order_acquire);
+    size_t pending = context->completed.size_approx();
+    drain_batch_.reserve(drain_batch_.size() + pending);
+    context->completed.drain(
+        [this](const CompletedSample &sample) {
+          drain_batch_.push_back(sample);
+        },
+        pending);
+  }
 
-    // Calculate recent deadline miss rate
-    size_t recent_measurements = std::min(it->second.size(), size_t(100));
-    size_t deadline_misses = 0;
+  std::sort(drain_batch_.begin(), drain_batch_.end(),
+            [](const CompletedSample &a, const CompletedSample &b) {
+              return a.start_ticks < b.start_ticks;
+            });
+  for (const CompletedSample &sample : drain_batch_) {
+    ingest_sample_locked(sample);
+  }
+}
 
-    for (size_t i = it->second.size() - recent_measurements;
-         i < it->second.size(); ++i) {
-      if (!it->second[i].deadline_met) {
-        deadline_misses++;
-      }
-    }
+std::shared_ptr<const TimingAnalyzerImpl::ConstraintTable>
+TimingAnalyzerImpl::load_constraints() const {
+  return std::atomic_load_explicit(&constraints_, std::memory_order_acquire);
+}
 
-    double miss_rate =
-        static_cast<double>(deadline_misses) / recent_measurements;
+const TimingAnalyzerImpl::ConstraintTable *
+TimingAnalyzerImpl::cached_constraints(
+    std::shared_ptr<const ConstraintTable> &table, uint64_t &version) {
+  // The table is stored before the version is bumped, so a reader that sees
+  // a new version loads a table at least that new
+  uint64_t current = constraint_version_.load(std::memory_order_acquire);
+  if (version != current) {
+    table = load_constraints();
+    version = current;
+  }
+  return table.get();
+}
 
-    if (miss_rate > constraint.deadline_miss_threshold) {
-      all_constraints_met = false;
+void TimingAnalyzerImpl::publish_constraints(
+    ComponentId component,
+    std::shared_ptr<const TimingConstraint> constraint) {
+  std::lock_guard<std::mutex> lock(constraints_mutex_);
 
-      log_message("ERROR", "TimingAnalyzer",
-                  "Timing constraint violation for " + component_name +
-                      ": miss rate " + std::to_string(miss_rate * 100.0) + "%");
+  // INVALID_COMPONENT_ID publishes an empty table
+  auto table = std::make_shared<ConstraintTable>();
+  if (component != INVALID_COMPONENT_ID) {
+    table->entries = load_constraints()->entries;
+    if (component >= table->entries.size()) {
+      table->entries.resize(component + 1);
     }
+    table->entries[component] = std::move(constraint);
   }
 
-  return all_constraints_met;
+  std::atomic_store_explicit(
+      &constraints_, std::shared_ptr<const ConstraintTable>(std::move(table)),
+      std::memory_order_release);
+  constraint_version_.fetch_add(1, std::memory_order_acq_rel);
 }
 
-TimingAnalysisReport
-TimingAnalyzerImpl::generate_report(bool include_raw_data) {
-  TimingAnalysisReport report{};
-  report.analysis_timestamp = std::chrono::steady_clock::now();
-  report.target_system = "BCI_System"; // Could be configurable
-  report.overall_timing_compliance = verify_timing_constraints();
-
-  std::lock_guard<std::mutex> lock(measurements_mutex_);
-
-  // Generate component statistics
-  for (const auto &[component_name, measurements] : measurement_history_) {
-    if (!measurements.empty()) {
-      auto stats = calculate_statistics(component_name, measurements);
-      report.component_stats.push_back(stats);
+bool TimingAnalyzerImpl::read_thread_counters(
+    ThreadContext &context, PerfCounterGroup::Reading &reading) {
+  if (!context.counters.is_open()) {
+    if (context.counters_failed) {
+      return false;
+    }
+    if (!context.counters.open()) {
+      context.counters_failed = true;
+      log_message("WARNING", "TimingAnalyzer",
+                  "Failed to open performance counters for thread");
+      return false;
     }
   }
+  return context.counters.read(reading);
+}
 
-  // Calculate overall system utilization score
-  if (!report.component_stats.empty()) {
-    double total_utilization = 0.0;
-    for (const auto &stats : report.component_stats) {
-      // Simple utilization calculation based on deadline compliance
-      double component_utilization = 1.0 - stats.deadline_miss_rate;
-      total_utilization += component_utilization;
+void TimingAnalyzerImpl::drain_trace_events_locked() {
+  uint32_t context_count = context_count_.load(std::memory_order_acquire);
+  for (uint32_t i = 0; i < context_count; ++i) {
+    ThreadContext *context = context_table_[i].load(std::memory_order_acquire);
+    SpscRing<TraceEvent> *ring =
+        context->trace_events.load(std::memory_order_acquire);
+    if (ring == nullptr) {
+      continue;
     }
-    report.system_utilization_score =
-        total_utilization / report.component_stats.size();
-  }
 
-  // Add recommendations
-  if (report.overall_timing_compliance) {
-    report.recommendations =
-        "System timing performance is within acceptable limits.";
-  } else {
-    report.recommendations = "Timing violations detected. Review component "
-                             "implementation and constraints.";
+    ring->drain([](const TraceEvent &event) {
+      auto &log = event.point->trace_log;
+      if (!log) {
+        log = std::make_unique<TracePointLog>(kTraceLogCapacity);
+      }
+      log->record(event.correlation_id, event.ticks);
+    });
   }
-
-  return report;
 }
 
-void TimingAnalyzerImpl::set_verification_callback(
-    TimingVerificationCallback callback) {
-  verification_callback_ = std::move(callback);
-}
+void TimingAnalyzerImpl::ingest_sample_locked(const CompletedSample &sample) {
+  ComponentState &component = *sample.component;
+
+  TimingSample record{};
+  record.component = component.id;
+  clock_.convert(sample.start_ticks, sample.end_ticks, record);
+  uint32_t violation_flags = 0;
+  if (sample.deferred) {
+    record.self_time = record.execution_time;
+    violation_flags = evaluate_deadline(
+        *cached_constraints(ingest_constraints_, ingest_constraints_version_),
+        component, record);
+  } else {
+    record.execution_time = sample.execution_time; // As checked at stop
+    record.self_time = sample.self_time;
+    record.deadline_met = sample.deadline_met;
+  }
+  record.jitter = sample.jitter;
+  record.counters = sample.counters;
+  record.parent = (sample.parent != nullptr) ? sample.parent->id
+                                             : INVALID_COMPONENT_ID;
+
+  ingest_record_locked(component, record, sample.span,
+                       sample.jitter_tracked);
+  if (violation_flags != 0) {
+    queue_ingest_violation_locked(component, record, violation_flags);
+  }
 
-void TimingAnalyzerImpl::set_resource_monitoring_callback(
-    ResourceMonitoringCallback callback) {
-  resource_callback_ = std::move(callback);
+  if (trace_writer_.is_open()) {
+    write_trace_record_locked(component, record);
+  }
+  if (shared_producer_.is_attached()) {
+    export_shared_record_locked(component, record);
+  }
 }
 
-void TimingAnalyzerImpl::clear_measurements() {
-  std::lock_guard<std::mutex> lock(measurements_mutex_);
-  measurement_history_.clear();
-  active_measurements_.clear();
-
-  log_message("INFO", "TimingAnalyzer", "All measurement data cleared");
-}
+void TimingAnalyzerImpl::ingest_record_locked(ComponentState &component,
+                                              TimingSample &record,
+                                              SpanNode *span,
+                                              bool jitter_tracked) {
+  if (!jitter_tracked) {
+    track_jitter(component, record, true);
+  }
 
-std::chrono::steady_clock::time_point
-TimingAnalyzerImpl::get_precise_timestamp() {
-  return std::chrono::steady_clock::now();
+  component.history.append(record);
+  component.running.add(record.execution_time.count(), record.deadline_met);
+  component.histogram.record(record.execution_time);
+  if (component.corrected_histogram) {
+    component.corrected_histogram->record_with_expected_interval(
+        record.execution_time,
+        std::chrono::nanoseconds(component.expected_interval_ns));
+  }
+  accumulate_counters(component.counter_stats, record.counters,
+                      record.deadline_met);
+
+  // A recursive span lies within a span of the same component, whose
+  // inclusive time already covers it
+  int64_t execution_ns = record.execution_time.count();
+  if (span == nullptr || !span->recursive) {
+    component.inclusive_ns += execution_ns;
+  }
+  component.exclusive_ns += record.self_time.count();
+  if (span != nullptr) {
+    ++span->calls;
+    span->inclusive_ns += execution_ns;
+    span->exclusive_ns += record.self_time.count();
+  }
 }
 
-bool TimingAnalyzerImpl::set_realtime_priority(bool enable) {
-  realtime_enabled_.store(enable);
-
-  if (enable) {
-    log_message("INFO", "TimingAnalyzer", "Real-time priority enabled");
+bool TimingAnalyzerImpl::track_jitter(ComponentState &component,
+                                      TimingSample &sample, bool wait) {
+  // Jitter is maintained incrementally, so the cost is independent of the
+  // history size. A stop only tries the lock: while another thread updates
+  // the same component, the sample reports the jitter published so far and
+  // its interval is added at ingest instead.
+  std::unique_lock<std::mutex> lock(component.jitter_mutex, std::defer_lock);
+  if (wait) {
+    lock.lock();
+  } else if (!lock.try_lock()) {
+    sample.jitter = std::chrono::nanoseconds{
+        component.last_jitter_ns.load(std::memory_order_relaxed)};
+    return false;
   }
 
+  sample.jitter = component.jitter.add(sample.start_time);
+  component.last_jitter_ns.store(sample.jitter.count(),
+                                 std::memory_order_relaxed);
   return true;
 }
 
-bool TimingAnalyzerImpl::configure_sampling_rate(double sample_rate) {
-  if (sample_rate <= 0.0 || sample_rate > 100000.0) { // Max 100kHz
-    return false;
+void TimingAnalyzerImpl::write_trace_record_locked(
+    const ComponentState &component, const TimingSample &record) {
+  if (!trace_writer_.is_defined(component.id) &&
+      !trace_writer_.define_component(component.id, component.name)) {
+    log_message("WARNING", "TimingAnalyzer",
+                "Component cannot be named in trace file: " + component.name);
   }
 
-  sampling_rate_.store(sample_rate);
-
-  log_message("INFO", "TimingAnalyzer",
-              "Sampling rate configured: " + std::to_string(sample_rate) +
-                  " Hz");
-
-  return true;
+  if (!trace_writer_.append(make_trace_record(record))) {
+    log_message("ERROR", "TimingAnalyzer",
+                "Trace file could not be extended; recording stopped");
+    trace_writer_.close();
+  }
 }
 
 // Helper method implementations
@@ -520,138 +3585,194 @@ bool TimingAnalyzerImpl::validate_component_name(
   }
 }
 
-PerformanceStatistics TimingAnalyzerImpl::calculate_statistics(
-    const std::string &component_name,
-    const std::vector<TimingMeasurement> &measurements) const {
+PerformanceStatistics
+TimingAnalyzerImpl::calculate_tiered_statistics(
+    const ComponentState &component, int64_t cutoff_ns) const {
+  // Called with samples evicted, so a window past the newest sample yields
+  // the summary fields without statistics
+  const SampleHistory &history = component.history;
+  PerformanceStatistics stats =
+      calculate_statistics(component, history.size());
+
+  RunningStatistics running = history.aggregate(0);
+  LatencyHistogram histogram(history.tiers().histogram_config());
+  history.tiers().for_each_since(
+      cutoff_ns, [&](const HistoryTiers::Interval &interval) {
+        running.merge(interval.stats);
+        histogram.merge(interval.histogram);
+      });
+  history.execution_times(0).for_each([&](int64_t execution_ns) {
+    histogram.record(std::chrono::nanoseconds(execution_ns));
+  });
+
+  apply_lifetime_statistics(stats, running, histogram, 0.999);
+  return stats;
+}
+
+PerformanceStatistics
+TimingAnalyzerImpl::calculate_statistics(const ComponentState &component,
+                                         size_t first_index,
+                                         double wcet_percentile,
+                                         bool lifetime) const {
+  const auto &history = component.history;
+  size_t count =
+      (first_index < history.size()) ? history.size() - first_index : 0;
 
   PerformanceStatistics stats{};
-  stats.component_name = component_name;
-  stats.measurement_count = measurements.size();
+  stats.component_name = component.name;
+  stats.samples_evicted = history.evicted_count();
+  stats.counters = component.counter_stats;
+  stats.inclusive_time = std::chrono::nanoseconds{component.inclusive_ns};
+  stats.exclusive_time = std::chrono::nanoseconds{component.exclusive_ns};
+
+  // The running accumulator covers every sample since the last clear; it
+  // matches the window exactly when the whole history is requested and
+  // nothing has been evicted
+  bool use_running =
+      lifetime || (first_index == 0 && history.evicted_count() == 0);
+  if (use_running) {
+    apply_lifetime_statistics(stats, component.running, component.histogram,
+                              wcet_percentile);
+    if (component.corrected_histogram) {
+      apply_corrected_statistics(stats, *component.corrected_histogram);
+    }
+    return stats;
+  }
 
-  if (measurements.empty()) {
+  if (count == 0) {
     return stats;
   }
 
-  // Calculate basic statistics
-  std::vector<std::chrono::nanoseconds> execution_times;
-  size_t deadline_misses = 0;
+  // Aggregates merge the history's per-interval buckets; only percentile
+  // selection streams the window's dense execution-time column
+  apply_running_statistics(stats, history.aggregate(first_index));
 
-  for (const auto &measurement : measurements) {
-    execution_times.push_back(measurement.execution_time);
-    if (!measurement.deadline_met) {
-      deadline_misses++;
+  std::vector<std::chrono::nanoseconds> execution_times;
+  execution_times.reserve(count);
+  history.execution_times(first_index).for_each([&](int64_t execution_ns) {
+    execution_times.emplace_back(execution_ns);
+  });
+
+  // The window's corrected percentiles back-fill its samples against the
+  // current period
+  if (component.expected_interval_ns > 0) {
+    LatencyHistogram corrected(component.histogram.config());
+    auto interval = std::chrono::nanoseconds(component.expected_interval_ns);
+    for (auto execution_time : execution_times) {
+      corrected.record_with_expected_interval(execution_time, interval);
     }
+    apply_corrected_statistics(stats, corrected);
   }
 
-  stats.min_execution_time =
-      *std::min_element(execution_times.begin(), execution_times.end());
-  stats.max_execution_time =
-      *std::max_element(execution_times.begin(), execution_times.end());
+  // Windowed percentiles are selected exactly from the retained samples
+  auto percentiles = TimingUtils::calculate_percentiles(
+      std::move(execution_times),
+      {0.95, 0.99, 0.999, 0.5, 0.9999, wcet_percentile});
+  stats.wcet_estimate = percentiles[5];
+  stats.median_execution_time = percentiles[3];
+  stats.p9999_execution_time = percentiles[4];
+  percentiles.resize(3);
+  stats.percentiles = std::move(percentiles);
 
-  // Calculate average
-  auto total_time =
-      std::accumulate(execution_times.begin(), execution_times.end(),
-                      std::chrono::nanoseconds{0});
-  stats.avg_execution_time = total_time / measurements.size();
+  return stats;
+}
 
-  // Calculate standard deviation
-  double variance = 0.0;
-  for (const auto &time : execution_times) {
-    double diff = static_cast<double>(time.count()) -
-                  static_cast<double>(stats.avg_execution_time.count());
-    variance += diff * diff;
+void TimingAnalyzerImpl::apply_running_statistics(
+    PerformanceStatistics &stats, const RunningStatistics &running) const {
+  stats.measurement_count = static_cast<size_t>(running.count);
+  if (running.count == 0) {
+    return;
   }
-  variance /= measurements.size();
-  stats.std_deviation = std::chrono::nanoseconds{
-      static_cast<std::chrono::nanoseconds::rep>(std::sqrt(variance))};
 
-  // Calculate deadline miss rate
-  stats.deadline_miss_rate =
-      static_cast<double>(deadline_misses) / measurements.size();
+  stats.min_execution_time = std::chrono::nanoseconds{running.min_ns};
+  stats.max_execution_time = std::chrono::nanoseconds{running.max_ns};
+  stats.avg_execution_time = std::chrono::nanoseconds{
+      static_cast<std::chrono::nanoseconds::rep>(running.mean_ns)};
+  stats.std_deviation = std::chrono::nanoseconds{
+      static_cast<std::chrono::nanoseconds::rep>(running.std_deviation())};
+  stats.deadline_miss_rate = running.deadline_miss_rate();
+}
 
-  // Calculate percentiles
-  stats.percentiles.resize(3);
-  stats.percentiles[0] =
-      TimingUtils::calculate_percentile(execution_times, 0.95); // 95th
-  stats.percentiles[1] =
-      TimingUtils::calculate_percentile(execution_times, 0.99); // 99th
-  stats.percentiles[2] =
-      TimingUtils::calculate_percentile(execution_times, 0.999); // 99.9th
+void TimingAnalyzerImpl::apply_lifetime_statistics(
+    PerformanceStatistics &stats, const RunningStatistics &running,
+    const LatencyHistogram &histogram, double wcet_percentile) const {
+  apply_running_statistics(stats, running);
+  if (histogram.total_count() == 0) {
+    return;
+  }
 
-  return stats;
+  // Percentiles over every sample come from the histogram, in time
+  // independent of the number of samples
+  auto percentiles = histogram.values_at_percentiles(
+      {0.95, 0.99, 0.999, 0.5, 0.9999, wcet_percentile});
+  stats.wcet_estimate = percentiles[5];
+  stats.median_execution_time = percentiles[3];
+  stats.p9999_execution_time = percentiles[4];
+  percentiles.resize(3);
+  stats.percentiles = std::move(percentiles);
 }
 
-bool TimingAnalyzerImpl::check_safety_constraints(
-    const TimingMeasurement &measurement) const {
-  std::lock_guard<std::mutex> lock(constraints_mutex_);
-
-  auto it = constraints_.find(measurement.task_name);
-  if (it == constraints_.end()) {
-    return true; // No constraints defined, assume safe
+void TimingAnalyzerImpl::apply_corrected_statistics(
+    PerformanceStatistics &stats, const LatencyHistogram &corrected) const {
+  stats.corrected_measurement_count = corrected.total_count();
+  if (corrected.total_count() > 0) {
+    stats.corrected_percentiles =
+        corrected.values_at_percentiles({0.95, 0.99, 0.999});
   }
+}
 
-  const auto &constraint = it->second;
+TimingMeasurement
+TimingAnalyzerImpl::make_measurement(const ComponentState &component,
+                                     const TimingSample &sample) const {
+  TimingMeasurement measurement{};
+  measurement.task_name = component.name;
+  measurement.start_time = sample.start_time;
+  measurement.end_time = sample.end_time;
+  measurement.execution_time = sample.execution_time;
+  measurement.jitter = sample.jitter;
+  measurement.deadline_met = sample.deadline_met;
+  measurement.self_time = sample.self_time;
+  if (const ComponentState *parent = component_state(sample.parent)) {
+    measurement.parent_task_name = parent->name;
+  }
+  return measurement;
+}
 
+bool TimingAnalyzerImpl::check_safety_constraints(
+    const ComponentState &component, const TimingConstraint &constraint,
+    const TimingSample &sample) {
   if (constraint.is_critical_path) {
     // Stricter safety checks for critical paths
-    if (measurement.execution_time > constraint.deadline * 1.1) { // 10% margin
+    if (sample.execution_time > constraint.deadline * 1.1) { // 10% margin
       return false;
     }
   }
 
-  if (verification_callback_) {
-    return verification_callback_(measurement, constraint);
+  std::shared_ptr<const TimingVerificationCallback> callback;
+  {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    callback = verification_callback_;
+  }
+  if (callback) {
+    // The callback API takes the full measurement; only build it when needed
+    return (*callback)(make_measurement(component, sample), constraint);
   }
 
-  return measurement.deadline_met;
+  return sample.deadline_met;
 }
 
 void TimingAnalyzerImpl::log_timing_violation(
-    const std::string &component_name,
-    const TimingMeasurement &measurement) const {
+    const std::string &component_name, const TimingSample &sample) const {
   log_message("WARNING", "TimingAnalyzer",
               "Deadline violation for " + component_name + ": " +
-                  std::to_string(measurement.execution_time.count()) + "ns");
-}
-
-std::chrono::nanoseconds TimingAnalyzerImpl::calculate_jitter(
-    const std::vector<TimingMeasurement> &measurements) const {
-
-  if (measurements.size() < 2) {
-    return std::chrono::nanoseconds{0};
-  }
-
-  // Calculate inter-arrival time jitter
-  std::vector<std::chrono::nanoseconds> intervals;
-  for (size_t i = 1; i < measurements.size(); ++i) {
-    auto interval = measurements[i].start_time - measurements[i - 1].start_time;
-    intervals.push_back(
-        std::chrono::duration_cast<std::chrono::nanoseconds>(interval));
-  }
-
-  if (intervals.empty()) {
-    return std::chrono::nanoseconds{0};
-  }
-
-  // Calculate average interval
-  auto total_interval = std::accumulate(intervals.begin(), intervals.end(),
-                                        std::chrono::nanoseconds{0});
-  auto avg_interval = total_interval / intervals.size();
-
-  // Calculate jitter as maximum deviation from average
-  std::chrono::nanoseconds max_deviation{0};
-  for (const auto &interval : intervals) {
-    auto deviation_count = (interval > avg_interval)
-                               ? (interval - avg_interval).count()
-                               : (avg_interval - interval).count();
-    max_deviation =
-        std::max(max_deviation, std::chrono::nanoseconds{deviation_count});
-  }
-
-  return max_deviation;
+                  std::to_string(sample.execution_time.count()) + "ns");
 }
 
 // Factory method implementation
+TimingAnalyzer::TimingAnalyzer(const TickCounter &tick_counter) noexcept
+    : tick_counter_(&tick_counter),
+      instance_serial_(g_next_analyzer_serial.fetch_add(1)) {}
+
 std::unique_ptr<TimingAnalyzer> TimingAnalyzer::create() {
   return std::make_unique<TimingAnalyzerImpl>();
 }
@@ -688,17 +3809,59 @@ calculate_percentile(const std::vector<std::chrono::nanoseconds> &measurements,
       return std::chrono::nanoseconds{0};
     }
 
-    auto sorted_measurements = measurements;
-    std::sort(sorted_measurements.begin(), sorted_measurements.end());
-
-    size_t index =
-        static_cast<size_t>(percentile * (sorted_measurements.size() - 1));
-    return sorted_measurements[index];
+    auto selected = measurements;
+    size_t index = static_cast<size_t>(
+        percentile * static_cast<double>(selected.size() - 1));
+    auto nth = selected.begin() + static_cast<std::ptrdiff_t>(index);
+    std::nth_element(selected.begin(), nth, selected.end());
+    return *nth;
   } catch (...) {
     return std::chrono::nanoseconds{0};
   }
 }
 
+std::vector<std::chrono::nanoseconds>
+calculate_percentiles(std::vector<std::chrono::nanoseconds> measurements,
+                      const std::vector<double> &percentiles) noexcept {
+  std::vector<std::chrono::nanoseconds> results;
+
+  try {
+    results.assign(percentiles.size(), std::chrono::nanoseconds{0});
+    if (measurements.empty()) {
+      return results;
+    }
+
+    // Select in ascending rank order so each selection only partitions the
+    // suffix left by the previous one
+    std::vector<size_t> order(percentiles.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      return percentiles[a] < percentiles[b];
+    });
+
+    auto first = measurements.begin();
+    for (size_t position : order) {
+      double percentile = percentiles[position];
+      if (percentile < 0.0 || percentile > 1.0) {
+        continue;
+      }
+
+      size_t index = static_cast<size_t>(
+          percentile * static_cast<double>(measurements.size() - 1));
+      auto nth = measurements.begin() + static_cast<std::ptrdiff_t>(index);
+      if (nth >= first) {
+        std::nth_element(first, nth, measurements.end());
+        first = nth;
+      }
+      results[position] = *nth;
+    }
+  } catch (...) {
+    // Return zeros on error
+  }
+
+  return results;
+}
+
 std::vector<size_t>
 detect_outliers(const std::vector<std::chrono::nanoseconds> &measurements,
                 double threshold) noexcept {
@@ -754,6 +3917,11 @@ bool validate_timing_constraint(const TimingConstraint &constraint) noexcept {
       return false;
     }
 
+    if (constraint.correct_coordinated_omission &&
+        constraint.period.count() == 0) {
+      return false;
+    }
+
     if (constraint.max_jitter.count() < 0) {
       return false;
     }
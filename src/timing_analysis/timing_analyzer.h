@@ -13,13 +13,30 @@
 
 #pragma once
 
+#include "latency_histogram.h"
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define IVV_TIMING_HAS_TSC 1
+#else
+#define IVV_TIMING_HAS_TSC 0
+#endif
+
+/// Set to 0 (ENABLE_TIMING_INSTRUMENTATION=OFF) to compile ScopedTiming and
+/// IVV_SCOPED_TIMING out of release images
+#ifndef IVV_TIMING_INSTRUMENTATION
+#define IVV_TIMING_INSTRUMENTATION 1
+#endif
+
 namespace IVVFramework {
 namespace TimingAnalysis {
 
@@ -33,6 +50,55 @@ enum class TimeUnit {
   SECONDS = 3
 };
 
+/**
+ * @brief Timestamp source used for measurements
+ */
+enum class ClockSource {
+  STEADY_CLOCK = 0, ///< std::chrono::steady_clock (CLOCK_MONOTONIC)
+  TSC = 1           ///< Invariant TSC calibrated against CLOCK_MONOTONIC
+};
+
+/**
+ * @class TickCounter
+ * @brief Raw timestamp read on the measurement path
+ *
+ * Reads steady_clock nanoseconds or invariant TSC cycles, whichever clock
+ * source the owning analyzer selected. Defined inline so that timers such
+ * as ScopedTiming read the clock without a call.
+ */
+class TickCounter {
+public:
+  /**
+   * @brief Read the raw tick counter
+   */
+  uint64_t now() const noexcept {
+#if IVV_TIMING_HAS_TSC
+    if (use_tsc_.load(std::memory_order_relaxed)) {
+      unsigned int aux;
+      return __rdtscp(&aux);
+    }
+#endif
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+  }
+
+protected:
+  std::atomic<bool> use_tsc_{false};
+};
+
+/**
+ * @brief Compact handle for a registered component
+ *
+ * Obtained once from TimingAnalyzer::register_component and used on the
+ * measurement hot path instead of the component name.
+ */
+using ComponentId = uint32_t;
+
+/// Handle value denoting an unregistered or invalid component
+constexpr ComponentId INVALID_COMPONENT_ID = 0;
+
 /**
  * @brief Timing constraint specification
  */
@@ -45,6 +111,10 @@ struct TimingConstraint {
   bool is_critical_path = false;           ///< Whether this is safety-critical
   double deadline_miss_threshold =
       0.001; ///< Acceptable deadline miss rate (0.1%)
+  bool correct_coordinated_omission = false; ///< Also report percentiles
+                                             ///< with the releases an
+                                             ///< overrun delayed back-filled;
+                                             ///< requires period
 };
 
 /**
@@ -58,10 +128,228 @@ struct TimingMeasurement {
   std::chrono::nanoseconds jitter;                  ///< Observed timing jitter
   bool deadline_met = true; ///< Whether deadline was met
   bool is_outlier = false;  ///< Statistical outlier detection
+  std::string parent_task_name; ///< Enclosing span, empty at top level
+  std::chrono::nanoseconds self_time{0}; ///< Time outside nested spans
+};
+
+/**
+ * @brief Performance counter deltas over one measurement
+ *
+ * Hardware counters count user-space events only and stay zero when no
+ * hardware PMU is available; software counters are always captured.
+ */
+struct PerformanceCounters {
+  uint64_t cycles = 0;           ///< CPU cycles (hardware)
+  uint64_t instructions = 0;     ///< Retired instructions (hardware)
+  uint64_t cache_misses = 0;     ///< Cache misses (hardware)
+  uint64_t context_switches = 0; ///< Context switches (software)
+  uint64_t cpu_migrations = 0;   ///< Migrations between CPUs (software)
+  uint64_t task_clock_ns = 0;    ///< Time spent on a CPU (software)
+  bool valid = false;    ///< Whether counters were captured for the sample
+  bool hardware = false; ///< Whether hardware counters were captured
+};
+
+/**
+ * @brief Performance counters aggregated over a component's samples
+ */
+struct PerformanceCounterStatistics {
+  uint64_t sample_count = 0;        ///< Samples with captured counters
+  PerformanceCounters total;        ///< Sum over those samples
+  PerformanceCounters maximum;      ///< Per-counter maximum
+  uint64_t missed_sample_count = 0; ///< Of which missed their deadline
+  PerformanceCounters missed_total; ///< Sum over deadline misses
+};
+
+/**
+ * @brief Compact timing result produced by the handle-based measurement API
+ *
+ * Carries the same data as TimingMeasurement but identifies the component by
+ * handle, so producing it requires no string allocation. The span fields
+ * are aggregated at ingest but not retained in the sample history.
+ */
+struct TimingSample {
+  ComponentId component = INVALID_COMPONENT_ID;     ///< Component handle
+  std::chrono::steady_clock::time_point start_time; ///< Measurement start
+  std::chrono::steady_clock::time_point end_time;   ///< Measurement end
+  std::chrono::nanoseconds execution_time{0};       ///< Actual execution time
+  std::chrono::nanoseconds jitter{0};               ///< Observed timing jitter
+  bool deadline_met = true; ///< Whether deadline was met
+  PerformanceCounters counters; ///< Counter deltas, when counters are enabled
+  ComponentId parent = INVALID_COMPONENT_ID; ///< Enclosing span's component
+  std::chrono::nanoseconds self_time{0}; ///< Time outside nested spans
+};
+
+/**
+ * @brief Per-component measurement history retention policy
+ *
+ * History storage is preallocated to max_samples. When max_age is set,
+ * samples older than max_age relative to the newest sample are evicted as
+ * well, so the history covers a time window bounded by max_samples.
+ * Jitter is tracked incrementally over the last jitter_window inter-arrival
+ * intervals, or over every interval since the last clear when it is 0.
+ * Retained samples are also pre-aggregated per aggregate_interval of start
+ * time so windowed queries only scan the interval at the window boundary.
+ *
+ * With second_tier_age or minute_tier_age set, evicted samples are
+ * downsampled instead of dropped: they are folded into per-second
+ * aggregates, which a background pass rolls up into per-minute aggregates
+ * once older than second_tier_age; per-minute aggregates expire after
+ * minute_tier_age. Aggregates keep count, mean, deviation, extrema,
+ * deadline misses and a tier_histogram latency histogram, and their
+ * storage is preallocated with the history.
+ */
+struct RetentionPolicy {
+  size_t max_samples = 65536;          ///< Ring buffer capacity in samples
+  std::chrono::nanoseconds max_age{0}; ///< Time window to retain (0 = off)
+  size_t jitter_window = 0;            ///< Jitter intervals (0 = unbounded)
+  std::chrono::nanoseconds aggregate_interval{
+      std::chrono::seconds(1)}; ///< Pre-aggregate bucket width
+  std::chrono::nanoseconds second_tier_age{0}; ///< Per-second aggregates kept,
+                                               ///< at most 1 day (0 = none)
+  std::chrono::nanoseconds minute_tier_age{0}; ///< Per-minute aggregates kept,
+                                               ///< at most 30 days (0 = none)
+  HistogramConfig tier_histogram{
+      3, std::chrono::seconds(60)}; ///< Layout of each aggregate's histogram
+};
+
+/**
+ * @brief Options for replaying a recorded trace into an analyzer
+ */
+struct TraceReplayOptions {
+  size_t worker_threads = 0; ///< Replay threads (0 = one per hardware thread)
+  bool reevaluate_deadlines = true; ///< Judge samples of constrained
+                                    ///< components against the configured
+                                    ///< deadline instead of the recording
+};
+
+/**
+ * @brief Handling of a timing violation when its dispatch queue is full
+ */
+enum class ViolationOverflowPolicy {
+  DROP = 0,           ///< Discard the violation and count it as dropped
+  DISPATCH_INLINE = 1 ///< Log and run the callback on the stopping thread
+};
+
+/**
+ * @brief Counters of the asynchronous violation dispatcher
+ */
+struct ViolationDispatchStatistics {
+  uint64_t queued = 0;            ///< Handed to the dispatcher thread
+  uint64_t dispatched = 0;        ///< Processed by the dispatcher thread
+  uint64_t dispatched_inline = 0; ///< Processed on the stopping thread
+  uint64_t dropped = 0;           ///< Discarded because the queue was full
+  uint64_t safety_violations = 0; ///< Safety checks that failed
+};
+
+/**
+ * @brief Losses on the measurement path
+ *
+ * Measuring threads never wait for the analyzer: a start without a free
+ * slot fails and a sample finding its thread's completion buffer full is
+ * discarded. Both are counted here and logged by the ingest thread.
+ */
+struct MeasurementStatistics {
+  uint64_t starts_rejected = 0; ///< Starts with every slot of the thread busy
+  uint64_t samples_dropped = 0; ///< Completed samples lost to a full buffer
+};
+
+/**
+ * @brief Scheduling policy of the analyzer's background threads
+ */
+enum class SchedulingPolicy {
+  OTHER = 0, ///< SCHED_OTHER, the default time-sharing policy
+  FIFO = 1   ///< SCHED_FIFO at RealtimeConfig::priority
+};
+
+/**
+ * @brief Real-time configuration of the analyzer's background threads
+ *
+ * Applies to threads the analyzer owns (violation dispatcher, sample
+ * ingest, analysis pool, resource sampler), never to the threads taking
+ * measurements.
+ */
+struct RealtimeConfig {
+  SchedulingPolicy policy = SchedulingPolicy::FIFO;
+  int priority = 10; ///< SCHED_FIFO priority (1-99); keep below the loops
+  std::vector<int> cpus; ///< CPUs to pin to (empty = housekeeping CPUs,
+                         ///< i.e. online CPUs not listed as isolated)
+  bool lock_memory = true;   ///< mlockall() current and future pages
+  bool prefault_stacks = true; ///< Touch each thread's stack when applied
+};
+
+/**
+ * @brief Outcome of the last real-time configuration
+ */
+struct RealtimeStatus {
+  bool enabled = false;            ///< A FIFO configuration is active
+  bool scheduling_applied = false; ///< Every thread got the policy
+  bool affinity_applied = false;   ///< Every thread got the CPU set
+  bool memory_locked = false;      ///< mlockall() succeeded
+  size_t threads_configured = 0;   ///< Thread applications since configure
+  std::vector<int> cpus;           ///< CPU set the threads are pinned to
+  std::vector<std::string> warnings; ///< Settings that could not be applied
+};
+
+/**
+ * @brief Timing quality of the periodic sampling engine
+ *
+ * Wakeup latency is how late each tick started relative to its absolute
+ * deadline; it is the engine's sampling jitter.
+ */
+struct SamplingStatistics {
+  bool running = false;
+  double sample_rate = 0.0; ///< Configured rate in Hz
+  uint64_t ticks = 0;       ///< Ticks executed
+  uint64_t missed_ticks = 0; ///< Deadlines skipped because a tick overran
+  std::chrono::nanoseconds mean_wakeup_latency{0};
+  std::chrono::nanoseconds p99_wakeup_latency{0};
+  std::chrono::nanoseconds max_wakeup_latency{0};
+  std::chrono::nanoseconds max_tick_duration{0}; ///< Longest probe pass
+};
+
+/**
+ * @brief Settings of cross-process timing collection over shared memory
+ *
+ * The collector's settings size the segment; producers take the ring size
+ * from the segment and use only poll_interval and liveness_timeout.
+ */
+struct SharedMemoryConfig {
+  size_t producer_capacity = 16; ///< Producer processes attached at once
+  size_t ring_capacity = 16384;  ///< Records buffered per producer
+  std::chrono::milliseconds poll_interval{10}; ///< Collector drain and
+                                               ///< producer flush period
+  std::chrono::milliseconds liveness_timeout{2000}; ///< Heartbeat age after
+                                                    ///< which the other side
+                                                    ///< counts as dead
+};
+
+/**
+ * @brief Counters of cross-process timing collection
+ */
+struct SharedMemoryStatistics {
+  bool collecting = false;          ///< This analyzer runs a collector
+  size_t producers_active = 0;      ///< Producers currently attached
+  uint64_t producers_attached = 0;  ///< Attachments since the collector started
+  uint64_t producers_lost = 0;      ///< Producers that died without detaching
+  uint64_t records_collected = 0;   ///< Records ingested from producers
+  uint64_t records_dropped = 0;     ///< Records producers found no room for
+  bool exporting = false;           ///< This analyzer exports its samples
+  bool export_attached = false;     ///< Export holds a slot of a collector
+  uint64_t records_exported = 0;    ///< Samples queued for the collector
+  uint64_t export_dropped = 0;      ///< Samples lost to a full ring or
+                                    ///< dictionary
 };
 
 /**
  * @brief Real-time performance statistics
+ *
+ * A periodic task that overruns its period delays the releases behind it,
+ * and those are never measured, so a stall counts as one slow sample and
+ * the percentiles look better than the latency releases saw. With
+ * TimingConstraint::correct_coordinated_omission, corrected_percentiles
+ * count each delayed release as well, back-filled from the period as
+ * HdrHistogram does; percentiles stays uncorrected. Windows reaching into
+ * downsampled history report no corrected percentiles.
  */
 struct PerformanceStatistics {
   std::string component_name;                     ///< Component identifier
@@ -75,6 +363,68 @@ struct PerformanceStatistics {
   double jitter_coefficient = 0.0; ///< Jitter variability measure
   std::vector<std::chrono::nanoseconds>
       percentiles; ///< 95th, 99th, 99.9th percentiles
+  std::chrono::nanoseconds median_execution_time{0}; ///< 50th percentile
+  std::chrono::nanoseconds p9999_execution_time{0};  ///< 99.99th percentile
+  uint64_t samples_evicted = 0; ///< Samples dropped by the retention policy
+  PerformanceCounterStatistics counters; ///< All samples since the last clear
+  std::chrono::nanoseconds inclusive_time{0}; ///< Total time since the last
+                                              ///< clear, nested spans included
+  std::chrono::nanoseconds exclusive_time{0}; ///< Of which outside nested
+                                              ///< spans
+  std::vector<std::chrono::nanoseconds>
+      corrected_percentiles; ///< 95th, 99th, 99.9th percentiles corrected
+                             ///< for coordinated omission; empty unless
+                             ///< the constraint enables the correction
+  uint64_t corrected_measurement_count = 0; ///< Measurements plus releases
+                                            ///< back-filled by the correction
+};
+
+/**
+ * @brief Aggregated samples of one interval of a component's history
+ *
+ * Percentiles come from a latency histogram, so they carry its relative
+ * error.
+ */
+struct HistoryInterval {
+  std::chrono::steady_clock::time_point start_time; ///< Interval start
+  std::chrono::nanoseconds duration{0};             ///< 1 s or 1 min
+  uint64_t measurement_count = 0;
+  uint64_t deadline_misses = 0;
+  std::chrono::nanoseconds min_execution_time{0};
+  std::chrono::nanoseconds max_execution_time{0};
+  std::chrono::nanoseconds avg_execution_time{0};
+  std::chrono::nanoseconds median_execution_time{0};
+  std::chrono::nanoseconds p99_execution_time{0};
+};
+
+/**
+ * @brief One call path of the span profile
+ *
+ * A call path is a component together with the chain of spans that
+ * enclosed it. TimingAnalysisReport::call_tree lists them depth-first, each
+ * entry followed by its children in order of decreasing inclusive time.
+ */
+struct CallTreeNode {
+  std::string component_name; ///< Component of the innermost span
+  std::string path;           ///< Component names from the root, '/'-joined
+  size_t depth = 0;           ///< 0 for top-level spans
+  std::ptrdiff_t parent_index = -1; ///< Entry of the enclosing path, -1 at
+                                    ///< top level
+  uint64_t calls = 0;               ///< Spans completed on this path
+  std::chrono::nanoseconds inclusive_time{0}; ///< Nested spans included
+  std::chrono::nanoseconds exclusive_time{0}; ///< Outside nested spans
+};
+
+/**
+ * @brief CPU utilization of one thread over a monitoring window
+ */
+struct ThreadUtilization {
+  int thread_id = 0;              ///< Kernel thread id
+  std::string thread_name;        ///< Thread name (comm)
+  double average_cpu = 0.0;       ///< Average percentage of one CPU
+  double peak_cpu = 0.0;          ///< Peak percentage of one CPU
+  uint64_t minor_page_faults = 0; ///< Minor faults during the window
+  uint64_t major_page_faults = 0; ///< Major faults during the window
 };
 
 /**
@@ -87,6 +437,13 @@ struct ResourceUtilization {
   std::chrono::nanoseconds measurement_window{0}; ///< Measurement time window
   std::vector<double> utilization_samples; ///< Time-series utilization data
   bool exceeds_safety_threshold = false;   ///< Whether safety limits exceeded
+
+  uint64_t peak_rss_bytes = 0;    ///< Largest resident set size sampled
+  uint64_t minor_page_faults = 0; ///< Process minor faults during the window
+  uint64_t major_page_faults = 0; ///< Process major faults during the window
+  uint64_t voluntary_context_switches = 0;   ///< During the window
+  uint64_t involuntary_context_switches = 0; ///< During the window
+  std::vector<ThreadUtilization> thread_utilization; ///< Per-thread CPU
 };
 
 /**
@@ -102,6 +459,9 @@ struct TimingAnalysisReport {
   std::vector<ResourceUtilization> resource_stats; ///< Resource utilization
   std::vector<std::string> timing_violations;      ///< Detected violations
   std::vector<std::string> safety_concerns;        ///< Safety-critical issues
+  std::vector<TimingMeasurement>
+      raw_measurements; ///< Retained samples, only with include_raw_data
+  std::vector<CallTreeNode> call_tree; ///< Flattened span profile
 
   bool overall_timing_compliance = true; ///< Overall system compliance
   double system_utilization_score = 0.0; ///< Overall system efficiency
@@ -114,6 +474,15 @@ struct TimingAnalysisReport {
 using TimingVerificationCallback =
     std::function<bool(const TimingMeasurement &, const TimingConstraint &)>;
 
+/**
+ * @brief Probe sampled periodically by the sampling engine
+ *
+ * Returns the current value of a monitored quantity, e.g. a queue depth or
+ * buffer fill level. Values must be non-negative; negative values are
+ * recorded as 0.
+ */
+using SamplingProbe = std::function<int64_t()>;
+
 /**
  * @brief Resource monitoring callback for external resource tracking
  */
@@ -130,6 +499,9 @@ using ResourceMonitoringCallback =
  * analysis, and resource utilization monitoring.
  *
  * Thread Safety: This class is thread-safe for concurrent timing measurements.
+ * Each thread records into its own preallocated measurement slots and hands
+ * completed samples to the history through a lock-free queue, so concurrent
+ * start/stop calls do not serialize on a shared lock.
  *
  * Real-time Constraints: Measurement overhead is minimized for real-time use.
  */
@@ -153,29 +525,160 @@ public:
    */
   virtual bool initialize() = 0;
 
+  /**
+   * @brief Initialize the timing analyzer with a specific timestamp source
+   * @param clock_source Requested timestamp source
+   * @return true if initialization successful, false otherwise
+   *
+   * The TSC source stores raw cycle counts on the measurement path and
+   * converts them to steady_clock time at ingest, re-calibrating for drift.
+   * It falls back to STEADY_CLOCK when no invariant TSC is available; see
+   * get_clock_source(). The source is fixed by the first initialization.
+   */
+  virtual bool initialize(ClockSource clock_source) = 0;
+
+  /**
+   * @brief Timestamp source in effect
+   * @return Clock source selected at initialization
+   */
+  virtual ClockSource get_clock_source() const = 0;
+
   /**
    * @brief Configure timing constraints for a component
    * @param component_name Name of the component to monitor
    * @param constraints Timing constraints to enforce
    * @return true if configuration successful, false otherwise
+   *
+   * May be called at runtime. The update publishes a new immutable
+   * constraint set without blocking measurements; measurements already
+   * being stopped finish against the previous set.
    */
   virtual bool configure_constraints(const std::string &component_name,
                                      const TimingConstraint &constraints) = 0;
 
+  /**
+   * @brief Configure timing constraints for a registered component
+   * @param component Handle returned from register_component
+   * @param constraints Timing constraints to enforce
+   * @return true if configuration successful, false otherwise
+   */
+  virtual bool configure_constraints(ComponentId component,
+                                     const TimingConstraint &constraints) = 0;
+
+  /**
+   * @brief Configure history retention for a component
+   * @param component_name Name of the component
+   * @param policy Retention policy; storage is preallocated immediately
+   * @return true if configuration successful, false otherwise
+   */
+  virtual bool configure_retention(const std::string &component_name,
+                                   const RetentionPolicy &policy) = 0;
+
+  /**
+   * @brief Configure history retention for a registered component
+   * @param component Handle returned from register_component
+   * @param policy Retention policy; storage is preallocated immediately
+   * @return true if configuration successful, false otherwise
+   */
+  virtual bool configure_retention(ComponentId component,
+                                   const RetentionPolicy &policy) = 0;
+
+  /**
+   * @brief Configure the latency histogram layout for a component
+   * @param component_name Name of the component
+   * @param config Histogram precision and range; recorded counts are reset
+   * @return true if configuration successful, false otherwise
+   */
+  virtual bool configure_histogram(const std::string &component_name,
+                                   const HistogramConfig &config) = 0;
+
+  /**
+   * @brief Configure the latency histogram layout for a registered component
+   * @param component Handle returned from register_component
+   * @param config Histogram precision and range; recorded counts are reset
+   * @return true if configuration successful, false otherwise
+   */
+  virtual bool configure_histogram(ComponentId component,
+                                   const HistogramConfig &config) = 0;
+
+  /**
+   * @brief Copy a component's latency histogram
+   * @param component Handle returned from register_component
+   * @param histogram Receives every execution time recorded since the last
+   *        clear; copies can be merged across components or analyzers
+   * @return true if the component exists, false otherwise
+   */
+  virtual bool get_latency_histogram(ComponentId component,
+                                     LatencyHistogram &histogram) = 0;
+
+  /**
+   * @brief Register a component and obtain its measurement handle
+   * @param component_name Name of the component to register
+   * @return Handle for the component (the existing handle if already
+   *         registered), or INVALID_COMPONENT_ID on failure
+   */
+  virtual ComponentId register_component(const std::string &component_name) = 0;
+
+  /**
+   * @brief Look up the name of a registered component
+   * @param component Handle returned from register_component
+   * @return Component name, or an empty string for unknown handles
+   */
+  virtual std::string get_component_name(ComponentId component) const = 0;
+
   /**
    * @brief Start timing measurement for a component
    * @param component_name Name of the component being measured
    * @return Measurement ID for stopping the measurement
+   *
+   * Convenience wrapper that resolves the name to a handle on each call;
+   * prefer the ComponentId overload on hot paths.
    */
   virtual uint64_t start_measurement(const std::string &component_name) = 0;
 
+  /**
+   * @brief Start timing measurement for a registered component
+   * @param component Handle returned from register_component
+   * @return Measurement ID for stopping the measurement, 0 on failure
+   *
+   * A thread has 256 slots for measurements in flight; a start while all
+   * are busy returns 0 and is counted in get_measurement_statistics().
+   *
+   * Measurements nest: one started while another measurement of the same
+   * thread is in flight is a span inside it. Each thread keeps its own
+   * span stack, so nesting costs no lock. When a nested span stops on its
+   * starting thread its time is subtracted from the enclosing span's
+   * exclusive time; spans stopped on another thread, or after their
+   * enclosing span, are not subtracted.
+   */
+  virtual uint64_t start_measurement(ComponentId component) = 0;
+
   /**
    * @brief Stop timing measurement and record results
    * @param measurement_id ID returned from start_measurement
-   * @return Timing measurement result
+   * @return Timing measurement result; jitter covers the component's
+   *         activations up to and including this one
    */
   virtual TimingMeasurement stop_measurement(uint64_t measurement_id) = 0;
 
+  /**
+   * @brief Stop timing measurement without materializing the component name
+   * @param measurement_id ID returned from start_measurement
+   * @param sample Receives the timing result
+   * @return true if the measurement was found and recorded, false otherwise
+   */
+  virtual bool stop_measurement(uint64_t measurement_id,
+                                TimingSample &sample) = 0;
+
+  /**
+   * @brief Get the measurement path's loss counters
+   * @return Counters since the analyzer was created
+   *
+   * Stopped samples wait in a per-thread completion buffer until the
+   * analyzer's ingest thread, or a query, moves them into the history.
+   */
+  virtual MeasurementStatistics get_measurement_statistics() const = 0;
+
   /**
    * @brief Measure execution time of a callable
    * @param component_name Name of the component being measured
@@ -195,16 +698,87 @@ public:
     return stop_measurement(id);
   }
 
+  /**
+   * @brief Measure execution time of a callable for a registered component
+   * @param component Handle returned from register_component
+   * @param callable Function or lambda to measure
+   * @return Compact timing result
+   */
+  template <typename Callable>
+  TimingSample measure_execution(ComponentId component, Callable &&callable) {
+    TimingSample sample{};
+    auto id = start_measurement(component);
+    try {
+      callable();
+    } catch (...) {
+      stop_measurement(id, sample); // Ensure measurement is stopped
+      throw;
+    }
+    stop_measurement(id, sample);
+    return sample;
+  }
+
+  /**
+   * @brief Read the analyzer's raw tick counter
+   * @return Ticks in the clock source selected at initialization
+   *
+   * Inline and lock-free; pairs of readings are passed to record_ticks().
+   */
+  uint64_t read_ticks() const noexcept { return tick_counter_->now(); }
+
+  /**
+   * @brief Record a measurement from two read_ticks() readings
+   * @param component Handle returned from register_component
+   * @param start_ticks Reading taken at measurement start
+   * @param end_ticks Reading taken at measurement end
+   *
+   * Skips the measurement slot and id of start/stop_measurement: the
+   * ticks go straight to the calling thread's completion buffer. The call
+   * takes no lock and never ingests; a full buffer drops the sample and
+   * counts it in get_measurement_statistics(). The ticks are converted
+   * and checked against the component's constraint at ingest, and a
+   * violation found then is dropped if the dispatcher's queue is full.
+   * Performance counters are not read. Samples for unknown components or
+   * before initialization are dropped.
+   */
+  virtual void record_ticks(ComponentId component, uint64_t start_ticks,
+                            uint64_t end_ticks) noexcept = 0;
+
+  /**
+   * @brief Process-unique identifier of this analyzer instance
+   *
+   * Never reused, unlike the object address; lets static caches such as
+   * ScopedTiming's component handle detect a different analyzer.
+   */
+  uint64_t instance_serial() const noexcept { return instance_serial_; }
+
   /**
    * @brief Analyze deadline compliance for a component
    * @param component_name Name of the component to analyze
    * @param analysis_window Time window for analysis
    * @return Performance statistics for the component
+   *
+   * When the window reaches past the retained samples of a component with
+   * downsampling enabled (see RetentionPolicy), the aggregates of the
+   * intervals starting inside the window are merged in, and percentiles
+   * come from their histograms.
    */
   virtual PerformanceStatistics
   analyze_deadline_compliance(const std::string &component_name,
                               std::chrono::nanoseconds analysis_window) = 0;
 
+  /**
+   * @brief Get the long-term trend of a component
+   * @param component_name Name of the component
+   * @param window Time window before now to cover
+   * @return Per-minute and per-second aggregates of downsampled history,
+   *         followed by per-second aggregates of the retained samples,
+   *         oldest first; intervals starting before the window are left out
+   */
+  virtual std::vector<HistoryInterval>
+  get_history_trend(const std::string &component_name,
+                    std::chrono::nanoseconds window) = 0;
+
   /**
    * @brief Measure timing jitter for a component
    * @param component_name Name of the component to analyze
@@ -215,12 +789,38 @@ public:
   measure_jitter(const std::string &component_name,
                  size_t sample_count = 1000) = 0;
 
+  /**
+   * @brief Record a trace event for end-to-end latency profiling
+   * @param point Trace point handle from register_component
+   * @param correlation_id Identifier carried by one item (e.g. a frame
+   *        number) through the trace points it passes
+   * @return true if the event was recorded, false otherwise
+   *
+   * Trace points share the component registry. Events are timestamped and
+   * appended to a per-thread lock-free buffer; start and end events may be
+   * marked on different threads.
+   */
+  virtual bool mark(ComponentId point, uint64_t correlation_id) = 0;
+
+  /**
+   * @brief Record a trace event for end-to-end latency profiling
+   * @param point Name of the trace point
+   * @param correlation_id Identifier carried by one item through the trace
+   *        points it passes
+   * @return true if the event was recorded, false otherwise
+   */
+  virtual bool mark(const std::string &point, uint64_t correlation_id) = 0;
+
   /**
    * @brief Profile system latency end-to-end
    * @param start_point Starting measurement point
    * @param end_point Ending measurement point
    * @param sample_count Number of samples to collect
    * @return Latency profiling results
+   *
+   * Pairs the most recent end_point events with the start_point events of
+   * the same correlation id. Each trace point retains a bounded number of
+   * recent events, so only recent items can be matched.
    */
   virtual PerformanceStatistics profile_latency(const std::string &start_point,
                                                 const std::string &end_point,
@@ -231,6 +831,15 @@ public:
    * @param resource_name Name of the resource to monitor
    * @param monitoring_duration Duration of monitoring
    * @return Resource utilization statistics
+   *
+   * Without a resource monitoring callback, a built-in sampler thread reads
+   * process and per-thread counters for the whole duration at the configured
+   * sampling rate (capped at 1 kHz) and the call blocks until it finishes.
+   * For "memory" (case-insensitive) the utilization is resident set size as
+   * a percentage of physical memory; for any other name it is process CPU
+   * time as a percentage of all online CPUs. Page faults, context switches
+   * and per-thread CPU are reported for every resource name. The counters
+   * are only available on Linux; elsewhere the result stays zero.
    */
   virtual ResourceUtilization monitor_resource_utilization(
       const std::string &resource_name,
@@ -238,6 +847,10 @@ public:
 
   /**
    * @brief Estimate worst-case execution time
+   *
+   * Covers every sample since the component was cleared, including those
+   * evicted from the retained history, like generate_report().
+   *
    * @param component_name Name of the component to analyze
    * @param confidence_level Statistical confidence level (e.g., 0.999)
    * @return WCET estimate with confidence bounds
@@ -254,15 +867,71 @@ public:
 
   /**
    * @brief Generate comprehensive timing analysis report
-   * @param include_raw_data Whether to include raw measurement data
+   * @param include_raw_data Whether to include raw measurement data; the
+   *        retained history is materialized into raw_measurements
    * @return Complete timing analysis report
+   *
+   * Component count, extrema, mean, deviation and miss rate cover every
+   * sample since the last clear and are maintained incrementally;
+   * percentiles and the WCET estimate come from each component's latency
+   * histogram, so report cost does not grow with history size. The span
+   * profile is included as call_tree.
    */
   virtual TimingAnalysisReport
   generate_report(bool include_raw_data = false) = 0;
 
+  /**
+   * @brief Get the span profile of every call path since the last clear
+   * @return Flattened call tree, see CallTreeNode
+   *
+   * Per-path totals are accumulated when samples are ingested, so building
+   * the profile costs time in the number of distinct paths only.
+   */
+  virtual std::vector<CallTreeNode> get_call_tree() = 0;
+
+  /**
+   * @brief Start recording ingested samples to a binary trace file
+   * @param path Trace file to create or truncate
+   * @return true if recording started
+   *
+   * Every sample ingested afterwards is appended as a fixed-size record to
+   * a memory-mapped trace file, with component names kept in the file's
+   * dictionary. Writing never waits for the disk. A recording already in
+   * progress is finished first.
+   */
+  virtual bool start_trace_recording(const std::string &path) = 0;
+
+  /**
+   * @brief Finish the current trace recording, if any
+   */
+  virtual void stop_trace_recording() = 0;
+
+  /**
+   * @brief Load a recorded trace into the measurement history
+   * @param path Trace file written by start_trace_recording()
+   * @param options Replay parallelism and deadline handling
+   * @return true if the file was read
+   *
+   * Components are matched by name and registered when unknown; each record
+   * is ingested like a live sample, so every analysis function covers it.
+   * The file is memory-mapped and replayed offline: the live measurement
+   * path, violation logging and trace recording are bypassed. Records are
+   * partitioned by component and sorted by start time on worker threads
+   * before the ingest lock is taken to merge them. To evaluate another
+   * constraint set, clear_measurements(), configure the constraints and
+   * import again.
+   */
+  virtual bool
+  import_trace(const std::string &path,
+               const TraceReplayOptions &options = TraceReplayOptions{}) = 0;
+
   /**
    * @brief Set custom timing verification callback
    * @param callback Custom verification function
+   *
+   * The callback runs on the violation dispatcher thread, not on the thread
+   * that stopped the measurement. Under the DISPATCH_INLINE overflow
+   * policy it may also run concurrently on a stopping thread.
    */
   virtual void
   set_verification_callback(TimingVerificationCallback callback) = 0;
@@ -281,25 +950,300 @@ public:
 
   /**
    * @brief Get current system timestamp with high precision
-   * @return High-precision timestamp
+   * @return High-precision timestamp from the configured clock source, in
+   *         the steady_clock time base
    */
   virtual std::chrono::steady_clock::time_point get_precise_timestamp() = 0;
 
   /**
-   * @brief Enable or disable real-time priority measurement
-   * @param enable Whether to use real-time priority
-   * @return true if successfully configured, false otherwise
+   * @brief Enable or disable real-time operation of background threads
+   * @param enable Apply a default RealtimeConfig, or revert to SCHED_OTHER
+   *        on all online CPUs and unlock memory
+   * @return true if every setting was applied, see configure_realtime()
    */
   virtual bool set_realtime_priority(bool enable) = 0;
 
+  /**
+   * @brief Configure scheduling, affinity and memory locking
+   * @param config Settings for the analyzer's background threads
+   * @return true if every setting was applied; false if some could not be
+   *         (details in get_realtime_status())
+   *
+   * Settings that can be applied are applied even when others fail, e.g.
+   * affinity without CAP_SYS_NICE. The violation dispatcher is configured
+   * immediately; pool and sampler threads apply the configuration to
+   * themselves before their next piece of work.
+   */
+  virtual bool configure_realtime(const RealtimeConfig &config) = 0;
+
+  /**
+   * @brief Get the outcome of the last real-time configuration
+   */
+  virtual RealtimeStatus get_realtime_status() const = 0;
+
   /**
    * @brief Configure measurement sampling rate
    * @param sample_rate Samples per second for continuous monitoring
    * @return true if successfully configured, false otherwise
+   *
+   * Sets the tick rate of the sampling engine (a running engine re-anchors
+   * its schedule on the next tick) and of monitor_resource_utilization().
    */
   virtual bool configure_sampling_rate(double sample_rate) = 0;
+
+  /**
+   * @brief Register a probe run on every sampling engine tick
+   * @param probe_name Component name the probe's values are recorded under
+   * @param probe Callable returning the current value
+   * @return Component handle, or INVALID_COMPONENT_ID on failure
+   *
+   * Each value is recorded like a measurement whose execution time is the
+   * value, so history, histogram, statistics and constraints apply: a
+   * constraint deadline of N nanoseconds acts as a threshold of N.
+   * Probes run on the engine thread and must not block.
+   */
+  virtual ComponentId register_probe(const std::string &probe_name,
+                                     SamplingProbe probe) = 0;
+
+  /**
+   * @brief Stop sampling a probe; its recorded history is kept
+   * @param probe Handle returned from register_probe
+   * @return false if no probe is registered under the handle
+   */
+  virtual bool unregister_probe(ComponentId probe) = 0;
+
+  /**
+   * @brief Start the periodic sampling engine at the configured rate
+   * @return false if not initialized or the engine thread cannot start
+   *
+   * Ticks are scheduled on absolute CLOCK_MONOTONIC deadlines, so the
+   * schedule does not drift. A tick that overruns skips the deadlines it
+   * missed instead of bursting to catch up.
+   */
+  virtual bool start_sampling() = 0;
+
+  /**
+   * @brief Stop the sampling engine and wait for its thread
+   */
+  virtual void stop_sampling() = 0;
+
+  /**
+   * @brief Get the sampling engine's tick and jitter counters
+   */
+  virtual SamplingStatistics get_sampling_statistics() const = 0;
+
+  /**
+   * @brief Enable or disable per-measurement performance counter capture
+   * @param enable Whether to capture counters
+   * @return true if configured, false if performance counters are
+   *         unavailable on this system
+   *
+   * When enabled, each thread opens its own perf_event counter group on its
+   * first measurement and reads it at start and stop; the deltas are
+   * attached to TimingSample::counters and aggregated into
+   * PerformanceStatistics::counters. Hardware counters are used when the
+   * PMU is accessible, otherwise only software counters are captured.
+   * Measurements stopped on a different thread carry no counters. Each
+   * read is a system call, so capture adds about two reads per measurement.
+   */
+  virtual bool enable_performance_counters(bool enable) = 0;
+
+  /**
+   * @brief Choose how violations are handled when their queue is full
+   * @param policy Overflow policy
+   * @return true if configured, false if not initialized
+   *
+   * stop_measurement() never logs or runs the verification callback itself:
+   * deadline misses, samples needing a safety check and measurements
+   * stopped on another thread than they started on are queued as compact
+   * records on a per-thread lock-free ring, and a dispatcher thread
+   * performs the logging and callbacks. The policy applies only when a
+   * thread's ring is full. The default is ViolationOverflowPolicy::DROP.
+   */
+  virtual bool
+  configure_violation_dispatch(ViolationOverflowPolicy policy) = 0;
+
+  /**
+   * @brief Get the violation dispatcher counters
+   * @return Counters since initialization
+   */
+  virtual ViolationDispatchStatistics
+  get_violation_dispatch_statistics() const = 0;
+
+  /**
+   * @brief Wait until violations queued before this call are processed
+   * @param timeout Maximum time to wait
+   * @return true if the queue was drained within the timeout
+   *
+   * Samples completed before the call are ingested first, so violations
+   * of record_ticks() samples are covered.
+   */
+  virtual bool flush_violations(
+      std::chrono::milliseconds timeout = std::chrono::seconds(1)) = 0;
+
+  /**
+   * @brief Collect timing samples of other processes through shared memory
+   * @param segment_name POSIX shared memory name, e.g. "/ivv_timing"
+   * @param config Segment size and polling settings
+   * @return false if not initialized, the sizes exceed 1024 producers or
+   *         2^30 records, or the segment cannot be created
+   *
+   * Creates the segment, replacing a stale one of the same name, and starts
+   * a collector thread. Every poll_interval it ingests the records of each
+   * producer like local samples, registering components by name and
+   * judging them against this analyzer's constraints where configured;
+   * misses are dispatched to the verification callback like local ones.
+   * Start times are moved into this process's clock domain through
+   * CLOCK_REALTIME offsets both sides publish. A producer whose process
+   * has exited, or whose heartbeat is older than liveness_timeout, is
+   * counted as lost and its slot is reclaimed after its records are read.
+   * A running collector is restarted.
+   */
+  virtual bool start_shared_collector(
+      const std::string &segment_name,
+      const SharedMemoryConfig &config = SharedMemoryConfig{}) = 0;
+
+  /**
+   * @brief Ingest what producers have queued, then remove the segment
+   */
+  virtual void stop_shared_collector() = 0;
+
+  /**
+   * @brief Forward every sample ingested by this analyzer to a collector
+   * @param segment_name Segment created by start_shared_collector()
+   * @param process_label Name the collector reports this producer under
+   * @param config Polling settings; the segment defines the sizes
+   * @return false if not initialized or the name is empty
+   *
+   * Samples are exported at ingest, so local analysis is unaffected. An
+   * export thread ingests this process's completed samples every
+   * poll_interval and publishes a heartbeat. When the collector is absent
+   * or has gone away, samples stay local and the thread attaches again
+   * once a collector is running. A running export is restarted.
+   */
+  virtual bool start_shared_export(
+      const std::string &segment_name, const std::string &process_label,
+      const SharedMemoryConfig &config = SharedMemoryConfig{}) = 0;
+
+  /**
+   * @brief Export the remaining samples and leave the collector
+   */
+  virtual void stop_shared_export() = 0;
+
+  /**
+   * @brief Get the collection and export counters
+   */
+  virtual SharedMemoryStatistics get_shared_memory_statistics() const = 0;
+
+protected:
+  /**
+   * @brief Construct with the tick counter read by read_ticks()
+   * @param tick_counter Counter owned by the implementation; it must be
+   *        constructed before this base and outlive the analyzer
+   */
+  explicit TimingAnalyzer(const TickCounter &tick_counter) noexcept;
+
+private:
+  const TickCounter *tick_counter_;
+  const uint64_t instance_serial_;
 };
 
+#if IVV_TIMING_INSTRUMENTATION
+
+/**
+ * @class ScopedTiming
+ * @brief RAII timer for a component bound at compile time
+ * @tparam Tag Type with `static constexpr const char *name()` returning the
+ *         component name
+ *
+ * Measures from construction to destruction. The component handle is
+ * resolved once per analyzer and cached in a static for the tag, so the
+ * steady state is two clock reads, an atomic load and a virtual
+ * record_ticks() call. That call looks up the thread's cached context and
+ * span path and pushes onto its completion buffer; it never blocks.
+ *
+ * @code
+ * struct DecodeTiming {
+ *   static constexpr const char *name() { return "decoder"; }
+ * };
+ * void decode(TimingAnalyzer &analyzer) {
+ *   ScopedTiming<DecodeTiming> timing(analyzer);
+ *   ...
+ * }
+ * @endcode
+ *
+ * Compiled to an empty object when IVV_TIMING_INSTRUMENTATION is 0.
+ */
+template <typename Tag> class ScopedTiming {
+public:
+  explicit ScopedTiming(TimingAnalyzer &analyzer)
+      : analyzer_(analyzer), component_(bind(analyzer)),
+        start_ticks_(analyzer.read_ticks()) {}
+
+  ~ScopedTiming() {
+    uint64_t end_ticks = analyzer_.read_ticks();
+    analyzer_.record_ticks(component_, start_ticks_, end_ticks);
+  }
+
+  ScopedTiming(const ScopedTiming &) = delete;
+  ScopedTiming &operator=(const ScopedTiming &) = delete;
+
+private:
+  /// Component handle for Tag, re-resolved when the analyzer changes
+  static ComponentId bind(TimingAnalyzer &analyzer) {
+    // [serial:32][component:32]; 0 never matches a live analyzer
+    static std::atomic<uint64_t> binding{0};
+
+    uint64_t serial = analyzer.instance_serial() & 0xFFFFFFFFu;
+    uint64_t cached = binding.load(std::memory_order_relaxed);
+    if ((cached >> 32) == serial) {
+      return static_cast<ComponentId>(cached);
+    }
+
+    ComponentId component = analyzer.register_component(Tag::name());
+    if (component != INVALID_COMPONENT_ID) {
+      binding.store((serial << 32) | component, std::memory_order_relaxed);
+    }
+    return component;
+  }
+
+  TimingAnalyzer &analyzer_;
+  const ComponentId component_;
+  const uint64_t start_ticks_;
+};
+
+#define IVV_TIMING_CONCAT_IMPL(a, b) a##b
+#define IVV_TIMING_CONCAT(a, b) IVV_TIMING_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Time the rest of the enclosing scope as component_name
+ * @param analyzer TimingAnalyzer reference
+ * @param component_name String literal naming the component
+ *
+ * Declares a local tag type and a ScopedTiming; one use per line.
+ */
+#define IVV_SCOPED_TIMING(analyzer, component_name)                            \
+  struct IVV_TIMING_CONCAT(IvvScopedTimingTag, __LINE__) {                     \
+    static constexpr const char *name() { return component_name; }             \
+  };                                                                           \
+  ::IVVFramework::TimingAnalysis::ScopedTiming<IVV_TIMING_CONCAT(              \
+      IvvScopedTimingTag, __LINE__)>                                           \
+  IVV_TIMING_CONCAT(ivv_scoped_timing_, __LINE__)(analyzer)
+
+#else // IVV_TIMING_INSTRUMENTATION
+
+template <typename Tag> class ScopedTiming {
+public:
+  explicit ScopedTiming(TimingAnalyzer &) noexcept {}
+  ScopedTiming(const ScopedTiming &) = delete;
+  ScopedTiming &operator=(const ScopedTiming &) = delete;
+};
+
+#define IVV_SCOPED_TIMING(analyzer, component_name)                            \
+  static_cast<void>(sizeof(analyzer))
+
+#endif // IVV_TIMING_INSTRUMENTATION
+
 /**
  * @namespace TimingUtils
  * @brief Utility functions for timing analysis
@@ -325,6 +1269,19 @@ std::chrono::nanoseconds
 calculate_percentile(const std::vector<std::chrono::nanoseconds> &measurements,
                      double percentile) noexcept;
 
+/**
+ * @brief Calculate several percentiles from one copy of the timing data
+ * @param measurements Timing measurements; consumed and reordered
+ * @param percentiles Percentiles to calculate (0.0 to 1.0)
+ * @return Percentile values in the order requested
+ *
+ * Uses selection rather than a full sort, so the cost is linear in the
+ * number of measurements for a small set of percentiles.
+ */
+std::vector<std::chrono::nanoseconds>
+calculate_percentiles(std::vector<std::chrono::nanoseconds> measurements,
+                      const std::vector<double> &percentiles) noexcept;
+
 /**
  * @brief Detect statistical outliers in timing data
  * @param measurements Vector of timing measurements
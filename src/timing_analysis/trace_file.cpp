@@ -0,0 +1,324 @@
+/**
+ * @file trace_file.cpp
+ * @brief Memory-mapped binary trace file implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "trace_file.h"
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+constexpr char kTraceMagic[8] = {'I', 'V', 'V', 'T', 'R', 'A', 'C', 'E'};
+constexpr uint32_t kTraceVersion = 1;
+constexpr size_t kHeaderSize = 4096;
+constexpr size_t kMaxNameLength = 255;
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+  uint32_t dictionary_capacity;
+  uint32_t dictionary_entry_size;
+  uint64_t dictionary_offset;
+  uint64_t data_offset;
+  uint64_t chunk_size;
+  uint64_t record_count; ///< Written on flush and close; informational
+};
+
+/// Dictionary slot; id is written last and is non-zero once the slot is used
+struct DictionaryEntry {
+  uint32_t id;
+  uint32_t length;
+  char name[kMaxNameLength + 1];
+};
+
+size_t page_size() noexcept {
+  return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+size_t round_up(size_t value, size_t multiple) noexcept {
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+constexpr size_t kDictionarySize =
+    sizeof(DictionaryEntry) * kTraceDictionaryCapacity;
+
+size_t data_offset() noexcept {
+  return round_up(kHeaderSize + kDictionarySize, page_size());
+}
+
+DictionaryEntry *dictionary(void *metadata) noexcept {
+  return reinterpret_cast<DictionaryEntry *>(static_cast<char *>(metadata) +
+                                             kHeaderSize);
+}
+
+} // anonymous namespace
+
+TraceRecord make_trace_record(const TimingSample &sample) noexcept {
+  TraceRecord record;
+  record.component = sample.component;
+  record.flags = sample.deadline_met ? kTraceFlagDeadlineMet : 0;
+  record.start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        sample.start_time.time_since_epoch())
+                        .count();
+  record.execution_ns = sample.execution_time.count();
+  record.jitter_ns = sample.jitter.count();
+  return record;
+}
+
+TimingSample to_timing_sample(const TraceRecord &record) noexcept {
+  TimingSample sample{};
+  sample.component = record.component;
+  sample.start_time = std::chrono::steady_clock::time_point(
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::nanoseconds(record.start_ns)));
+  sample.execution_time = std::chrono::nanoseconds(record.execution_ns);
+  sample.end_time = sample.start_time + sample.execution_time;
+  sample.self_time = sample.execution_time; // Traces carry no span nesting
+  sample.jitter = std::chrono::nanoseconds(record.jitter_ns);
+  sample.deadline_met = (record.flags & kTraceFlagDeadlineMet) != 0;
+  return sample;
+}
+
+// TraceFileWriter
+
+bool TraceFileWriter::open(const std::string &path, size_t chunk_size) {
+  close();
+
+  fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd_ < 0) {
+    return false;
+  }
+
+  // Blocks are allocated before they are mapped, so a full disk fails
+  // here instead of raising SIGBUS on a store
+  size_t metadata_size = data_offset();
+  if (posix_fallocate(fd_, 0, static_cast<off_t>(metadata_size)) != 0) {
+    close();
+    return false;
+  }
+
+  void *metadata = mmap(nullptr, metadata_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd_, 0);
+  if (metadata == MAP_FAILED) {
+    close();
+    return false;
+  }
+  metadata_ = metadata;
+
+  chunk_size_ = round_up(std::max(chunk_size, page_size()),
+                         page_size() * sizeof(TraceRecord));
+  chunk_records_ = chunk_size_ / sizeof(TraceRecord);
+  chunk_index_ = 0;
+  record_count_ = 0;
+  defined_.assign(kTraceDictionaryCapacity, false);
+
+  FileHeader header{};
+  std::memcpy(header.magic, kTraceMagic, sizeof(header.magic));
+  header.version = kTraceVersion;
+  header.record_size = sizeof(TraceRecord);
+  header.dictionary_capacity = kTraceDictionaryCapacity;
+  header.dictionary_entry_size = sizeof(DictionaryEntry);
+  header.dictionary_offset = kHeaderSize;
+  header.data_offset = metadata_size;
+  header.chunk_size = chunk_size_;
+  std::memcpy(metadata_, &header, sizeof(header));
+
+  if (!map_next_chunk()) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void TraceFileWriter::close() noexcept {
+  if (fd_ < 0) {
+    return;
+  }
+
+  unmap_chunk();
+  if (metadata_ != nullptr) {
+    FileHeader *header = static_cast<FileHeader *>(metadata_);
+    header->record_count = record_count_;
+    munmap(metadata_, data_offset());
+    metadata_ = nullptr;
+  }
+
+  // Drop the unused tail of the last chunk; should this fail, the
+  // zero-filled tail still marks the end of the data
+  auto used = static_cast<off_t>(data_offset() +
+                                 record_count_ * sizeof(TraceRecord));
+  int truncated = ftruncate(fd_, used);
+  (void)truncated;
+  ::close(fd_);
+  fd_ = -1;
+}
+
+bool TraceFileWriter::define_component(ComponentId component,
+                                       const std::string &name) noexcept {
+  if (metadata_ == nullptr || component == INVALID_COMPONENT_ID ||
+      component >= kTraceDictionaryCapacity || name.size() > kMaxNameLength) {
+    return false;
+  }
+
+  DictionaryEntry &entry = dictionary(metadata_)[component];
+  std::memcpy(entry.name, name.data(), name.size());
+  entry.name[name.size()] = '\0';
+  entry.length = static_cast<uint32_t>(name.size());
+  entry.id = component;
+  defined_[component] = true;
+  return true;
+}
+
+bool TraceFileWriter::append(const TraceRecord &record) noexcept {
+  if (chunk_ == nullptr) {
+    return false;
+  }
+  if (chunk_position_ == chunk_records_ && !map_next_chunk()) {
+    return false;
+  }
+
+  chunk_[chunk_position_++] = record;
+  ++record_count_;
+  return true;
+}
+
+void TraceFileWriter::flush() noexcept {
+  if (metadata_ == nullptr) {
+    return;
+  }
+
+  static_cast<FileHeader *>(metadata_)->record_count = record_count_;
+  msync(metadata_, data_offset(), MS_ASYNC);
+  if (chunk_ != nullptr) {
+    msync(chunk_, chunk_size_, MS_ASYNC);
+  }
+}
+
+bool TraceFileWriter::map_next_chunk() noexcept {
+  unmap_chunk();
+
+  // The chunk's blocks are allocated up front; a store into a hole the
+  // file system cannot back would raise SIGBUS instead of failing here
+  size_t offset = data_offset() + chunk_index_ * chunk_size_;
+  if (posix_fallocate(fd_, static_cast<off_t>(offset),
+                      static_cast<off_t>(chunk_size_)) != 0) {
+    return false;
+  }
+
+  void *chunk = mmap(nullptr, chunk_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd_, static_cast<off_t>(offset));
+  if (chunk == MAP_FAILED) {
+    return false;
+  }
+
+  chunk_ = static_cast<TraceRecord *>(chunk);
+  chunk_position_ = 0;
+  ++chunk_index_;
+  return true;
+}
+
+void TraceFileWriter::unmap_chunk() noexcept {
+  if (chunk_ != nullptr) {
+    munmap(chunk_, chunk_size_);
+    chunk_ = nullptr;
+  }
+}
+
+// TraceFileReader
+
+bool TraceFileReader::open(const std::string &path) {
+  close();
+
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat status {};
+  if (fstat(fd, &status) != 0 ||
+      static_cast<size_t>(status.st_size) < data_offset()) {
+    ::close(fd);
+    return false;
+  }
+
+  mapping_size_ = static_cast<size_t>(status.st_size);
+  void *mapping = mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    mapping_size_ = 0;
+    return false;
+  }
+  mapping_ = mapping;
+
+  FileHeader header;
+  std::memcpy(&header, mapping_, sizeof(header));
+  if (std::memcmp(header.magic, kTraceMagic, sizeof(kTraceMagic)) != 0 ||
+      header.version != kTraceVersion ||
+      header.record_size != sizeof(TraceRecord) ||
+      header.dictionary_capacity != kTraceDictionaryCapacity ||
+      header.dictionary_entry_size != sizeof(DictionaryEntry) ||
+      header.dictionary_offset % alignof(DictionaryEntry) != 0 ||
+      header.dictionary_offset > mapping_size_ ||
+      mapping_size_ - header.dictionary_offset < kDictionarySize ||
+      header.data_offset % alignof(TraceRecord) != 0 ||
+      header.data_offset > mapping_size_) {
+    close();
+    return false;
+  }
+
+  const char *base = static_cast<const char *>(mapping_);
+  const auto *entries = reinterpret_cast<const DictionaryEntry *>(
+      base + header.dictionary_offset);
+  for (uint32_t id = 1; id < kTraceDictionaryCapacity; ++id) {
+    if (entries[id].id == id && entries[id].length <= kMaxNameLength) {
+      components_.push_back(
+          Component{id, std::string(entries[id].name, entries[id].length)});
+    }
+  }
+
+  // Written records form a prefix of the data area; binary search for the
+  // first zero-filled slot so files left open by a crashed writer load too
+  records_ = reinterpret_cast<const TraceRecord *>(base + header.data_offset);
+  uint64_t low = 0;
+  uint64_t high = (mapping_size_ - header.data_offset) / sizeof(TraceRecord);
+  while (low < high) {
+    uint64_t middle = low + (high - low) / 2;
+    if (records_[middle].component != INVALID_COMPONENT_ID) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  record_count_ = low;
+
+  madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+  return true;
+}
+
+void TraceFileReader::close() noexcept {
+  if (mapping_ != nullptr) {
+    munmap(mapping_, mapping_size_);
+  }
+  mapping_ = nullptr;
+  mapping_size_ = 0;
+  records_ = nullptr;
+  record_count_ = 0;
+  components_.clear();
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,214 @@
+/**
+ * @file trace_file.h
+ * @brief Memory-mapped binary trace files of timing samples
+ *
+ * A trace file stores a stream of fixed-size sample records after a header
+ * and a component-id dictionary. The writer appends through memory-mapped
+ * chunks and never calls fsync, so recording costs a 32-byte store per
+ * sample; the kernel writes pages back in the background. The reader maps
+ * the whole file read-only.
+ *
+ * Layout (native byte order):
+ *   [header, one page]
+ *   [dictionary: kTraceDictionaryCapacity entries indexed by component id]
+ *   [records: chunk after chunk of TraceRecord]
+ *
+ * The file is extended one chunk at a time and unwritten space reads as
+ * zeros. A record with component INVALID_COMPONENT_ID therefore marks the
+ * end of the data, which lets the reader recover files whose writer never
+ * closed them.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include "timing_analyzer.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/// Component ids a trace dictionary can name
+constexpr uint32_t kTraceDictionaryCapacity = 4096;
+
+/// Default size of the chunks the writer maps and extends the file by
+constexpr size_t kDefaultTraceChunkSize = size_t{64} << 20;
+
+/**
+ * @brief On-disk record of one timing sample
+ */
+struct TraceRecord {
+  uint32_t component = INVALID_COMPONENT_ID; ///< Dictionary id
+  uint32_t flags = 0;                        ///< See kTraceFlag*
+  int64_t start_ns = 0;     ///< Start time in steady_clock nanoseconds
+  int64_t execution_ns = 0; ///< Execution time in nanoseconds
+  int64_t jitter_ns = 0;    ///< Jitter observed at ingest
+};
+
+static_assert(sizeof(TraceRecord) == 32, "TraceRecord layout is fixed");
+
+/// TraceRecord::flags bit set when the sample met its deadline
+constexpr uint32_t kTraceFlagDeadlineMet = 1u << 0;
+
+/**
+ * @brief Convert a sample to its on-disk record
+ */
+TraceRecord make_trace_record(const TimingSample &sample) noexcept;
+
+/**
+ * @brief Convert an on-disk record back to a sample
+ */
+TimingSample to_timing_sample(const TraceRecord &record) noexcept;
+
+/**
+ * @class TraceFileWriter
+ * @brief Append-only writer of a trace file
+ *
+ * Thread Safety: not thread-safe; callers provide external locking.
+ */
+class TraceFileWriter {
+public:
+  TraceFileWriter() = default;
+  ~TraceFileWriter() { close(); }
+  TraceFileWriter(const TraceFileWriter &) = delete;
+  TraceFileWriter &operator=(const TraceFileWriter &) = delete;
+
+  /**
+   * @brief Create or truncate a trace file and map its first chunk
+   * @param path File to write
+   * @param chunk_size Bytes per chunk; rounded up to whole pages
+   * @return false if the file could not be created or mapped
+   */
+  bool open(const std::string &path,
+            size_t chunk_size = kDefaultTraceChunkSize);
+
+  /**
+   * @brief Record the header, unmap and trim the file to its data
+   */
+  void close() noexcept;
+
+  /**
+   * @brief Whether a file is open
+   */
+  bool is_open() const noexcept { return fd_ >= 0; }
+
+  /**
+   * @brief Name a component id in the dictionary
+   * @param component Component id; must be below kTraceDictionaryCapacity
+   * @param name Component name, at most 255 bytes
+   * @return false if the id or name does not fit
+   */
+  bool define_component(ComponentId component,
+                        const std::string &name) noexcept;
+
+  /**
+   * @brief Whether a component id is already named in the dictionary
+   */
+  bool is_defined(ComponentId component) const noexcept {
+    return component < defined_.size() && defined_[component];
+  }
+
+  /**
+   * @brief Append a record, mapping the next chunk when the current is full
+   * @param record Record to append
+   * @return false if the file could not be extended, e.g. the disk is full;
+   *         chunks are allocated on disk before they are mapped
+   */
+  bool append(const TraceRecord &record) noexcept;
+
+  /**
+   * @brief Start asynchronous write-back of the mapped pages
+   *
+   * Does not wait for the data to reach the disk.
+   */
+  void flush() noexcept;
+
+  /**
+   * @brief Number of records appended
+   */
+  uint64_t record_count() const noexcept { return record_count_; }
+
+private:
+  bool map_next_chunk() noexcept;
+  void unmap_chunk() noexcept;
+
+  int fd_ = -1;
+  void *metadata_ = nullptr; ///< Header and dictionary mapping
+  TraceRecord *chunk_ = nullptr;
+  size_t chunk_size_ = 0;
+  size_t chunk_records_ = 0;
+  size_t chunk_position_ = 0; ///< Records written to the current chunk
+  uint64_t chunk_index_ = 0;  ///< Index of the next chunk to map
+  uint64_t record_count_ = 0;
+  std::vector<bool> defined_;
+};
+
+/**
+ * @class TraceFileReader
+ * @brief Read-only view of a trace file
+ *
+ * Thread Safety: const member functions may be called concurrently.
+ */
+class TraceFileReader {
+public:
+  /// Named component of the dictionary
+  struct Component {
+    ComponentId id;
+    std::string name;
+  };
+
+  TraceFileReader() = default;
+  ~TraceFileReader() { close(); }
+  TraceFileReader(const TraceFileReader &) = delete;
+  TraceFileReader &operator=(const TraceFileReader &) = delete;
+
+  /**
+   * @brief Map a trace file and validate its header
+   * @param path File to read
+   * @return false if the file is missing, truncated or not a trace file
+   */
+  bool open(const std::string &path);
+
+  /**
+   * @brief Unmap the file
+   */
+  void close() noexcept;
+
+  /**
+   * @brief Whether a file is mapped
+   */
+  bool is_open() const noexcept { return mapping_ != nullptr; }
+
+  /**
+   * @brief Components named in the dictionary, in id order
+   */
+  const std::vector<Component> &components() const noexcept {
+    return components_;
+  }
+
+  /**
+   * @brief Number of records in the file
+   */
+  uint64_t record_count() const noexcept { return record_count_; }
+
+  /**
+   * @brief Records in append order; valid while the file is open
+   */
+  const TraceRecord *records() const noexcept { return records_; }
+
+private:
+  void *mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+  const TraceRecord *records_ = nullptr;
+  uint64_t record_count_ = 0;
+  std::vector<Component> components_;
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
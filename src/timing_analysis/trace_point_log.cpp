@@ -0,0 +1,93 @@
+/**
+ * @file trace_point_log.cpp
+ * @brief Bounded per-trace-point event log implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "trace_point_log.h"
+#include <algorithm>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+namespace {
+
+/// Index slots probed per insert or lookup
+constexpr uint64_t kMaxProbes = 16;
+
+size_t round_up_pow2(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+/// splitmix64 finalizer; correlation ids are often sequential
+uint64_t mix(uint64_t value) noexcept {
+  value ^= value >> 30;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31;
+  return value;
+}
+
+} // anonymous namespace
+
+TracePointLog::TracePointLog(size_t capacity)
+    : events_(round_up_pow2(std::max<size_t>(capacity, 1))),
+      index_(events_.size() * 2) {
+  event_mask_ = events_.size() - 1;
+  index_mask_ = index_.size() - 1;
+}
+
+void TracePointLog::record(uint64_t correlation_id, uint64_t ticks) noexcept {
+  uint64_t sequence = next_sequence_++;
+  events_[sequence & event_mask_] = Event{correlation_id, ticks};
+
+  // Reuse the slot holding this id, a stale slot, or the oldest probed slot
+  uint64_t home = mix(correlation_id);
+  IndexEntry *target = nullptr;
+  for (uint64_t probe = 0; probe < kMaxProbes; ++probe) {
+    IndexEntry &entry = index_[(home + probe) & index_mask_];
+    if (!is_live(entry) || entry.correlation_id == correlation_id) {
+      target = &entry;
+      break;
+    }
+    if (target == nullptr ||
+        entry.sequence_plus_one < target->sequence_plus_one) {
+      target = &entry;
+    }
+  }
+
+  target->correlation_id = correlation_id;
+  target->sequence_plus_one = sequence + 1;
+}
+
+bool TracePointLog::find(uint64_t correlation_id,
+                         uint64_t &ticks) const noexcept {
+  uint64_t home = mix(correlation_id);
+  for (uint64_t probe = 0; probe < kMaxProbes; ++probe) {
+    const IndexEntry &entry = index_[(home + probe) & index_mask_];
+    if (entry.sequence_plus_one == 0) {
+      return false; // Never used: the id was not inserted past this slot
+    }
+    if (entry.correlation_id == correlation_id && is_live(entry)) {
+      ticks = events_[(entry.sequence_plus_one - 1) & event_mask_].ticks;
+      return true;
+    }
+  }
+  return false;
+}
+
+void TracePointLog::clear() noexcept {
+  std::fill(index_.begin(), index_.end(), IndexEntry{});
+  next_sequence_ = 0;
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
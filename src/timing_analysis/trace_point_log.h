@@ -0,0 +1,114 @@
+/**
+ * @file trace_point_log.h
+ * @brief Bounded per-trace-point event log indexed by correlation id
+ *
+ * Keeps the most recent events seen at one trace point together with a
+ * fixed-size hash index, so the latency matcher can find the event carrying
+ * a given correlation id in constant time.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @class TracePointLog
+ * @brief Fixed-capacity ring of (correlation id, timestamp) events
+ *
+ * Older events are overwritten once the ring is full. Index lookups probe a
+ * bounded number of slots, so both recording and lookup are O(1); an event
+ * whose index entry was displaced by a probe collision is simply not found.
+ * When a correlation id is recorded more than once, the latest event wins.
+ *
+ * Thread Safety: not thread-safe; callers provide external locking.
+ */
+class TracePointLog {
+public:
+  /**
+   * @brief Construct a log and preallocate its storage
+   * @param capacity Number of events to retain; rounded up to a power of two
+   */
+  explicit TracePointLog(size_t capacity);
+
+  /**
+   * @brief Record an event
+   * @param correlation_id Identifier of the item passing the trace point
+   * @param ticks Raw timestamp of the event
+   */
+  void record(uint64_t correlation_id, uint64_t ticks) noexcept;
+
+  /**
+   * @brief Look up the retained event for a correlation id
+   * @param correlation_id Identifier to find
+   * @param ticks Receives the event timestamp when found
+   * @return true if a retained event carries the correlation id
+   */
+  bool find(uint64_t correlation_id, uint64_t &ticks) const noexcept;
+
+  /**
+   * @brief Visit retained events from newest to oldest
+   * @param visitor Callable (uint64_t correlation_id, uint64_t ticks)
+   *        returning false to stop
+   */
+  template <typename Visitor> void visit_newest_first(Visitor &&visitor) const {
+    for (uint64_t i = 0; i < size(); ++i) {
+      const Event &event = events_[(next_sequence_ - 1 - i) & event_mask_];
+      if (!visitor(event.correlation_id, event.ticks)) {
+        return;
+      }
+    }
+  }
+
+  /**
+   * @brief Number of retained events
+   */
+  size_t size() const noexcept {
+    return (next_sequence_ < events_.size())
+               ? static_cast<size_t>(next_sequence_)
+               : events_.size();
+  }
+
+  /**
+   * @brief Number of events recorded since the last clear
+   */
+  uint64_t total_recorded() const noexcept { return next_sequence_; }
+
+  /**
+   * @brief Discard all events
+   */
+  void clear() noexcept;
+
+private:
+  struct Event {
+    uint64_t correlation_id = 0;
+    uint64_t ticks = 0;
+  };
+
+  struct IndexEntry {
+    uint64_t correlation_id = 0;
+    uint64_t sequence_plus_one = 0; ///< 0 marks a never-used slot
+  };
+
+  bool is_live(const IndexEntry &entry) const noexcept {
+    return entry.sequence_plus_one != 0 &&
+           next_sequence_ - (entry.sequence_plus_one - 1) <= events_.size();
+  }
+
+  std::vector<Event> events_;
+  std::vector<IndexEntry> index_;
+  uint64_t event_mask_ = 0;
+  uint64_t index_mask_ = 0;
+  uint64_t next_sequence_ = 0;
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
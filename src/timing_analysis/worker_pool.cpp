@@ -0,0 +1,139 @@
+/**
+ * @file worker_pool.cpp
+ * @brief Worker pool implementation
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "worker_pool.h"
+#include <algorithm>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+WorkerPool::WorkerPool(size_t concurrency)
+    : concurrency_((concurrency > 0)
+                       ? concurrency
+                       : std::max(1u, std::thread::hardware_concurrency())) {}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    stopping_ = true;
+  }
+  work_ready_.notify_all();
+  for (auto &helper : helpers_) {
+    helper.join();
+  }
+}
+
+void WorkerPool::parallel_for(size_t count,
+                              const std::function<void(size_t)> &task) {
+  if (count == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> loop_lock(loop_mutex_);
+  if (!helpers_started_) {
+    start_helpers();
+    helpers_started_ = true;
+  }
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    task_ = &task;
+    count_ = count;
+    next_index_.store(0, std::memory_order_relaxed);
+    error_ = nullptr;
+    active_helpers_ = helpers_.size();
+    ++generation_;
+  }
+  work_ready_.notify_all();
+
+  run_indices();
+
+  {
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    work_done_.wait(lock, [this]() { return active_helpers_ == 0; });
+    task_ = nullptr;
+    error = error_;
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void WorkerPool::set_thread_setup(std::function<void()> setup) {
+  std::lock_guard<std::mutex> lock(state_mutex_);
+  thread_setup_ = std::move(setup);
+  ++setup_generation_;
+}
+
+void WorkerPool::start_helpers() noexcept {
+  try {
+    for (size_t i = 1; i < concurrency_; ++i) {
+      helpers_.emplace_back(&WorkerPool::helper_loop, this);
+    }
+  } catch (const std::exception &) {
+    // Fewer helpers only reduce parallelism; the caller always participates
+  }
+}
+
+void WorkerPool::helper_loop() {
+  uint64_t seen_generation = 0;
+  uint64_t seen_setup = 0;
+  while (true) {
+    std::function<void()> setup;
+    {
+      std::unique_lock<std::mutex> lock(state_mutex_);
+      work_ready_.wait(lock, [&]() {
+        return stopping_ || generation_ != seen_generation;
+      });
+      if (stopping_) {
+        return;
+      }
+      seen_generation = generation_;
+      if (seen_setup != setup_generation_) {
+        seen_setup = setup_generation_;
+        setup = thread_setup_;
+      }
+    }
+
+    if (setup) {
+      try {
+        setup();
+      } catch (...) {
+        // Setup only tunes the thread; the loop runs regardless
+      }
+    }
+    run_indices();
+
+    {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      --active_helpers_;
+    }
+    work_done_.notify_one();
+  }
+}
+
+void WorkerPool::run_indices() noexcept {
+  for (size_t index = next_index_.fetch_add(1, std::memory_order_relaxed);
+       index < count_;
+       index = next_index_.fetch_add(1, std::memory_order_relaxed)) {
+    try {
+      (*task_)(index);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      if (!error_) {
+        error_ = std::current_exception();
+      }
+    }
+  }
+}
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
@@ -0,0 +1,102 @@
+/**
+ * @file worker_pool.h
+ * @brief Small fixed-size worker pool for parallel analysis passes
+ *
+ * Runs index-parallel loops on helper threads plus the calling thread.
+ * Used for off-lock analysis work such as per-component report statistics
+ * and offline trace replay.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace IVVFramework {
+namespace TimingAnalysis {
+
+/**
+ * @class WorkerPool
+ * @brief Helper threads that share index-parallel loops with the caller
+ *
+ * Helper threads are started on the first parallel_for(), so an owner that
+ * never runs parallel work never creates threads. Loops from different
+ * callers are serialized.
+ *
+ * Thread Safety: parallel_for() may be called from any thread.
+ */
+class WorkerPool {
+public:
+  /**
+   * @brief Construct an idle pool
+   * @param concurrency Threads working on a loop, including the caller
+   *        (0 = one per hardware thread)
+   */
+  explicit WorkerPool(size_t concurrency = 0);
+  ~WorkerPool();
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  /**
+   * @brief Threads working on a loop, including the caller
+   */
+  size_t concurrency() const noexcept { return concurrency_; }
+
+  /**
+   * @brief Run task(i) for every i in [0, count) and wait for completion
+   * @param count Number of indices
+   * @param task Callable invoked once per index, possibly concurrently
+   *
+   * If a task throws, remaining indices still run and the first exception
+   * is rethrown to the caller. When helper threads cannot be started the
+   * loop runs on the calling thread alone.
+   */
+  void parallel_for(size_t count, const std::function<void(size_t)> &task);
+
+  /**
+   * @brief Set a function each helper thread runs before its next loop
+   * @param setup Called once per helper on the helper thread, e.g. to
+   *        apply scheduling settings; never called on the caller's thread
+   */
+  void set_thread_setup(std::function<void()> setup);
+
+private:
+  void start_helpers() noexcept;
+  void helper_loop();
+  void run_indices() noexcept;
+
+  const size_t concurrency_;
+  std::vector<std::thread> helpers_;
+  bool helpers_started_ = false; ///< Guarded by loop_mutex_
+
+  std::mutex loop_mutex_; ///< Serializes parallel_for() callers
+
+  std::mutex state_mutex_;
+  std::condition_variable work_ready_;
+  std::condition_variable work_done_;
+  uint64_t generation_ = 0; ///< Incremented per loop; guarded by state_mutex_
+  size_t active_helpers_ = 0;
+  bool stopping_ = false;
+  std::function<void()> thread_setup_; ///< Guarded by state_mutex_
+  uint64_t setup_generation_ = 0;      ///< Incremented per set_thread_setup
+
+  // Current loop; written before generation_ is published
+  const std::function<void(size_t)> *task_ = nullptr;
+  size_t count_ = 0;
+  std::atomic<size_t> next_index_{0};
+  std::exception_ptr error_; ///< Guarded by state_mutex_
+};
+
+} // namespace TimingAnalysis
+} // namespace IVVFramework
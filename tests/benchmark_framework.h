@@ -0,0 +1,98 @@
+/**
+ * @file benchmark_framework.h
+ * @brief Simple micro-benchmark harness for IV&V Framework
+ *
+ * Companion to simple_test_framework.h for performance regressions. Each
+ * benchmark is calibrated to a minimum repetition time, warmed up, then
+ * repeated; the per-operation times of the repetitions give min, median
+ * and p99. Heap allocations made by the benchmark thread are counted per
+ * operation. Results can be written as JSON for release-to-release
+ * comparison.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace SimpleBenchmark {
+
+/// Runs `iterations` operations of the benchmarked code
+using BenchmarkBody = std::function<void(uint64_t iterations)>;
+
+/// Creates the benchmark state and returns the body that uses it; called
+/// once per benchmark so skipped benchmarks never construct their state
+using BenchmarkSetup = std::function<BenchmarkBody()>;
+
+struct BenchmarkCase {
+  std::string name; ///< "Suite/benchmark"
+  BenchmarkSetup setup;
+};
+
+struct BenchmarkConfig {
+  size_t warmup_repetitions = 2; ///< Unmeasured repetitions after calibration
+  size_t repetitions = 20;       ///< Measured repetitions
+  std::chrono::milliseconds min_repetition_time{20}; ///< Calibration target
+  std::string filter; ///< Run only benchmarks whose name contains this
+  bool silence_console = true; ///< Discard std::cout of code under test
+};
+
+struct BenchmarkResult {
+  std::string name;
+  uint64_t iterations = 0; ///< Operations per repetition
+  size_t repetitions = 0;
+  double min_ns = 0.0;    ///< Fastest repetition, ns per operation
+  double median_ns = 0.0; ///< Median repetition, ns per operation
+  double p99_ns = 0.0;    ///< 99th percentile repetition, ns per operation
+  double mean_ns = 0.0;   ///< Mean over repetitions, ns per operation
+  double allocations_per_op = 0.0;
+  double bytes_per_op = 0.0;
+  std::string error; ///< Set if setup or the body threw
+};
+
+class BenchmarkRunner {
+private:
+  BenchmarkConfig config_;
+  std::vector<BenchmarkCase> benchmarks_;
+  std::vector<BenchmarkResult> results_;
+
+  BenchmarkResult run_one(const BenchmarkCase &benchmark) const;
+
+public:
+  explicit BenchmarkRunner(BenchmarkConfig config = BenchmarkConfig{});
+
+  void add_benchmark(const std::string &name, BenchmarkSetup setup);
+  void run_all();
+  bool write_json(std::ostream &out) const;
+  const std::vector<BenchmarkResult> &results() const { return results_; }
+  int get_exit_code() const;
+};
+
+/**
+ * @brief Heap allocations and bytes requested by the calling thread
+ *
+ * Counted by the replacement operator new in the benchmark executable;
+ * allocations by background threads of the code under test are excluded.
+ */
+struct AllocationCounters {
+  uint64_t allocations = 0;
+  uint64_t bytes = 0;
+};
+AllocationCounters thread_allocations() noexcept;
+
+/**
+ * @brief Keep the compiler from discarding a computed value
+ */
+template <typename T> inline void do_not_optimize(const T &value) {
+  __asm__ __volatile__("" : : "r,m"(value) : "memory");
+}
+
+} // namespace SimpleBenchmark
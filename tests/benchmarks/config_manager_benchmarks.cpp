@@ -0,0 +1,73 @@
+/**
+ * @file config_manager_benchmarks.cpp
+ * @brief ConfigManager benchmark suite
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "../../src/core/config_manager.h"
+#include "../benchmark_framework.h"
+#include <memory>
+#include <string>
+
+using namespace IVVFramework::Core;
+using namespace SimpleBenchmark;
+
+namespace {
+
+/// Manager with the default safety parameters plus benchmark values
+std::shared_ptr<ConfigManager> create_manager() {
+  auto manager = std::make_shared<ConfigManager>();
+  manager->initialize("");
+  manager->set_int("benchmark.int", 42);
+  manager->set_double("benchmark.double", 0.25);
+  manager->set_string("benchmark.string", "benchmark value");
+  return manager;
+}
+
+} // anonymous namespace
+
+void register_config_manager_benchmarks(BenchmarkRunner &runner) {
+  runner.add_benchmark("ConfigManager/get_string", []() {
+    auto manager = create_manager();
+    return BenchmarkBody([manager](uint64_t iterations) {
+      const std::string name = "benchmark.string";
+      for (uint64_t i = 0; i < iterations; ++i) {
+        do_not_optimize(manager->get_string(name));
+      }
+    });
+  });
+
+  runner.add_benchmark("ConfigManager/get_int", []() {
+    auto manager = create_manager();
+    return BenchmarkBody([manager](uint64_t iterations) {
+      const std::string name = "benchmark.int";
+      for (uint64_t i = 0; i < iterations; ++i) {
+        do_not_optimize(manager->get_int(name));
+      }
+    });
+  });
+
+  runner.add_benchmark("ConfigManager/get_double", []() {
+    auto manager = create_manager();
+    return BenchmarkBody([manager](uint64_t iterations) {
+      const std::string name = "benchmark.double";
+      for (uint64_t i = 0; i < iterations; ++i) {
+        do_not_optimize(manager->get_double(name));
+      }
+    });
+  });
+
+  // Lookup of a parameter that does not exist
+  runner.add_benchmark("ConfigManager/get_int_missing", []() {
+    auto manager = create_manager();
+    return BenchmarkBody([manager](uint64_t iterations) {
+      const std::string name = "benchmark.missing";
+      for (uint64_t i = 0; i < iterations; ++i) {
+        do_not_optimize(manager->get_int(name, 7));
+      }
+    });
+  });
+}
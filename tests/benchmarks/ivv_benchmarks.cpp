@@ -0,0 +1,372 @@
+/**
+ * @file ivv_benchmarks.cpp
+ * @brief Micro-benchmark runner for IV&V Framework
+ *
+ * Implements the harness declared in benchmark_framework.h and runs the
+ * benchmark suites of every module.
+ *
+ * Usage: ivv_benchmarks [--filter text] [--repetitions n] [--warmup n]
+ *                       [--min-time-ms n] [--json path]
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "../benchmark_framework.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <streambuf>
+
+namespace {
+
+// Allocation counters of the current thread, updated by operator new
+thread_local uint64_t tls_allocations = 0;
+thread_local uint64_t tls_allocated_bytes = 0;
+
+void *counted_allocate(std::size_t size) noexcept {
+  ++tls_allocations;
+  tls_allocated_bytes += size;
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+} // anonymous namespace
+
+void *operator new(std::size_t size) {
+  void *memory = counted_allocate(size);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void *operator new[](std::size_t size) {
+  void *memory = counted_allocate(size);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return counted_allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return counted_allocate(size);
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+namespace SimpleBenchmark {
+
+namespace {
+
+/// Discards everything written to it
+class NullBuffer : public std::streambuf {
+protected:
+  int overflow(int c) override { return traits_type::not_eof(c); }
+  std::streamsize xsputn(const char *, std::streamsize count) override {
+    return count;
+  }
+};
+
+/// Redirects std::cout to a NullBuffer while in scope
+class ConsoleSilencer {
+public:
+  explicit ConsoleSilencer(bool enable)
+      : previous_(enable ? std::cout.rdbuf(&null_buffer_) : nullptr) {}
+  ~ConsoleSilencer() {
+    if (previous_ != nullptr) {
+      std::cout.rdbuf(previous_);
+    }
+  }
+  ConsoleSilencer(const ConsoleSilencer &) = delete;
+  ConsoleSilencer &operator=(const ConsoleSilencer &) = delete;
+
+private:
+  NullBuffer null_buffer_;
+  std::streambuf *previous_;
+};
+
+double elapsed_ns(std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - begin)
+      .count();
+}
+
+/// Nearest-rank percentile of an ascending sequence
+double percentile(const std::vector<double> &sorted, double fraction) {
+  size_t rank = static_cast<size_t>(
+      std::ceil(fraction * static_cast<double>(sorted.size())));
+  return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+std::string json_escape(const std::string &text) {
+  std::string escaped;
+  for (char c : text) {
+    switch (c) {
+    case '"':
+      escaped += "\\\"";
+      break;
+    case '\\':
+      escaped += "\\\\";
+      break;
+    case '\n':
+      escaped += "\\n";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20) {
+        char code[8];
+        std::snprintf(code, sizeof(code), "\\u%04x", c);
+        escaped += code;
+      } else {
+        escaped += c;
+      }
+    }
+  }
+  return escaped;
+}
+
+std::string utc_timestamp() {
+  std::time_t now = std::time(nullptr);
+  std::tm utc{};
+  gmtime_r(&now, &utc);
+  char text[32];
+  std::strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%SZ", &utc);
+  return text;
+}
+
+} // anonymous namespace
+
+AllocationCounters thread_allocations() noexcept {
+  return AllocationCounters{tls_allocations, tls_allocated_bytes};
+}
+
+BenchmarkRunner::BenchmarkRunner(BenchmarkConfig config)
+    : config_(std::move(config)) {}
+
+void BenchmarkRunner::add_benchmark(const std::string &name,
+                                    BenchmarkSetup setup) {
+  benchmarks_.push_back({name, std::move(setup)});
+}
+
+BenchmarkResult BenchmarkRunner::run_one(const BenchmarkCase &benchmark) const {
+  BenchmarkResult result;
+  result.name = benchmark.name;
+
+  ConsoleSilencer silencer(config_.silence_console);
+  BenchmarkBody body = benchmark.setup();
+
+  // Double the iteration count until one repetition takes long enough
+  constexpr uint64_t kMaxIterations = uint64_t{1} << 30;
+  const double target_ns =
+      std::chrono::duration<double, std::nano>(config_.min_repetition_time)
+          .count();
+  uint64_t iterations = 1;
+  while (true) {
+    auto begin = std::chrono::steady_clock::now();
+    body(iterations);
+    if (elapsed_ns(begin) >= target_ns || iterations >= kMaxIterations) {
+      break;
+    }
+    iterations *= 2;
+  }
+
+  for (size_t r = 0; r < config_.warmup_repetitions; ++r) {
+    body(iterations);
+  }
+
+  // Reserve first so the harness's own allocation is not attributed to the
+  // benchmark
+  std::vector<double> per_op_ns;
+  per_op_ns.reserve(config_.repetitions);
+  AllocationCounters before = thread_allocations();
+  for (size_t r = 0; r < config_.repetitions; ++r) {
+    auto begin = std::chrono::steady_clock::now();
+    body(iterations);
+    per_op_ns.push_back(elapsed_ns(begin) / static_cast<double>(iterations));
+  }
+  AllocationCounters after = thread_allocations();
+
+  double operations =
+      static_cast<double>(iterations) * static_cast<double>(per_op_ns.size());
+  result.iterations = iterations;
+  result.repetitions = per_op_ns.size();
+  result.allocations_per_op =
+      static_cast<double>(after.allocations - before.allocations) / operations;
+  result.bytes_per_op =
+      static_cast<double>(after.bytes - before.bytes) / operations;
+
+  double total = 0.0;
+  for (double value : per_op_ns) {
+    total += value;
+  }
+  std::sort(per_op_ns.begin(), per_op_ns.end());
+  result.min_ns = per_op_ns.front();
+  result.median_ns = percentile(per_op_ns, 0.5);
+  result.p99_ns = percentile(per_op_ns, 0.99);
+  result.mean_ns = total / static_cast<double>(per_op_ns.size());
+  return result;
+}
+
+void BenchmarkRunner::run_all() {
+  std::cout << std::left << std::setw(44) << "Benchmark" << std::right
+            << std::setw(12) << "min ns" << std::setw(12) << "median ns"
+            << std::setw(12) << "p99 ns" << std::setw(10) << "allocs"
+            << std::setw(12) << "iterations" << "\n";
+
+  for (const auto &benchmark : benchmarks_) {
+    if (!config_.filter.empty() &&
+        benchmark.name.find(config_.filter) == std::string::npos) {
+      continue;
+    }
+
+    BenchmarkResult result;
+    try {
+      result = run_one(benchmark);
+    } catch (const std::exception &e) {
+      result.name = benchmark.name;
+      result.error = e.what();
+    } catch (...) {
+      result.name = benchmark.name;
+      result.error = "Unknown exception";
+    }
+
+    std::cout << std::left << std::setw(44) << result.name << std::right;
+    if (result.error.empty()) {
+      std::cout << std::fixed << std::setprecision(1) << std::setw(12)
+                << result.min_ns << std::setw(12) << result.median_ns
+                << std::setw(12) << result.p99_ns << std::setprecision(2)
+                << std::setw(10) << result.allocations_per_op
+                << std::setw(12) << result.iterations << std::endl;
+    } else {
+      std::cout << "  FAILED - " << result.error << std::endl;
+    }
+    results_.push_back(std::move(result));
+  }
+}
+
+bool BenchmarkRunner::write_json(std::ostream &out) const {
+  out << std::setprecision(6) << std::fixed;
+  out << "{\n";
+  out << "  \"schema_version\": 1,\n";
+  out << "  \"timestamp\": \"" << utc_timestamp() << "\",\n";
+  out << "  \"compiler\": \"" << json_escape(__VERSION__) << "\",\n";
+#ifdef DEBUG
+  out << "  \"optimized\": false,\n";
+#else
+  out << "  \"optimized\": true,\n";
+#endif
+  out << "  \"config\": {\"warmup_repetitions\": "
+      << config_.warmup_repetitions
+      << ", \"repetitions\": " << config_.repetitions
+      << ", \"min_repetition_time_ms\": "
+      << config_.min_repetition_time.count() << "},\n";
+  out << "  \"benchmarks\": [";
+  for (size_t i = 0; i < results_.size(); ++i) {
+    const BenchmarkResult &result = results_[i];
+    out << (i == 0 ? "\n" : ",\n");
+    out << "    {\"name\": \"" << json_escape(result.name) << "\"";
+    if (!result.error.empty()) {
+      out << ", \"error\": \"" << json_escape(result.error) << "\"}";
+      continue;
+    }
+    out << ", \"iterations\": " << result.iterations
+        << ", \"repetitions\": " << result.repetitions
+        << ", \"min_ns\": " << result.min_ns
+        << ", \"median_ns\": " << result.median_ns
+        << ", \"p99_ns\": " << result.p99_ns
+        << ", \"mean_ns\": " << result.mean_ns
+        << ", \"allocations_per_op\": " << result.allocations_per_op
+        << ", \"bytes_per_op\": " << result.bytes_per_op << "}";
+  }
+  out << "\n  ]\n}\n";
+  return static_cast<bool>(out);
+}
+
+int BenchmarkRunner::get_exit_code() const {
+  for (const auto &result : results_) {
+    if (!result.error.empty()) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+} // namespace SimpleBenchmark
+
+// Benchmark suite registration, one per module
+extern void
+register_timing_analyzer_benchmarks(SimpleBenchmark::BenchmarkRunner &runner);
+extern void
+register_logger_benchmarks(SimpleBenchmark::BenchmarkRunner &runner);
+extern void
+register_safety_monitor_benchmarks(SimpleBenchmark::BenchmarkRunner &runner);
+extern void
+register_config_manager_benchmarks(SimpleBenchmark::BenchmarkRunner &runner);
+extern void
+register_fault_injector_benchmarks(SimpleBenchmark::BenchmarkRunner &runner);
+
+int main(int argc, char **argv) {
+  SimpleBenchmark::BenchmarkConfig config;
+  std::string json_path;
+  for (int i = 1; i < argc; ++i) {
+    std::string option = argv[i];
+    if (i + 1 >= argc) {
+      std::cerr << "Missing value for " << option << std::endl;
+      return 2;
+    }
+    std::string value = argv[++i];
+    if (option == "--filter") {
+      config.filter = value;
+    } else if (option == "--repetitions") {
+      config.repetitions = std::max<size_t>(1, std::stoul(value));
+    } else if (option == "--warmup") {
+      config.warmup_repetitions = std::stoul(value);
+    } else if (option == "--min-time-ms") {
+      config.min_repetition_time = std::chrono::milliseconds(std::stol(value));
+    } else if (option == "--json") {
+      json_path = value;
+    } else {
+      std::cerr << "Unknown option " << option << std::endl;
+      return 2;
+    }
+  }
+
+  SimpleBenchmark::BenchmarkRunner runner(config);
+
+  // Register all benchmark suites
+  register_timing_analyzer_benchmarks(runner);
+  register_logger_benchmarks(runner);
+  register_safety_monitor_benchmarks(runner);
+  register_config_manager_benchmarks(runner);
+  register_fault_injector_benchmarks(runner);
+
+  // Run benchmarks
+  runner.run_all();
+
+  if (!json_path.empty()) {
+    std::ofstream json(json_path);
+    if (!runner.write_json(json)) {
+      std::cerr << "Failed to write " << json_path << std::endl;
+      return 1;
+    }
+  }
+
+  return runner.get_exit_code();
+}
@@ -0,0 +1,67 @@
+/**
+ * @file logger_benchmarks.cpp
+ * @brief Logger benchmark suite
+ *
+ * Console output is discarded by the harness, so the console benchmark
+ * measures formatting and stream cost rather than terminal speed.
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "../../src/core/logger.h"
+#include "../benchmark_framework.h"
+#include <cstdio>
+#include <memory>
+#include <string>
+
+using namespace IVVFramework::Core;
+using namespace SimpleBenchmark;
+
+namespace {
+
+std::shared_ptr<Logger> create_logger(LogDestination destination,
+                                      const std::string &file_path = "") {
+  auto logger = std::make_shared<Logger>();
+  LogConfig config;
+  config.destinations.push_back(destination);
+  config.log_file_path = file_path;
+  logger->initialize("Benchmark", config);
+  return logger;
+}
+
+BenchmarkBody log_info_body(std::shared_ptr<Logger> logger) {
+  return [logger](uint64_t iterations) {
+    const std::string message = "Benchmark log message";
+    for (uint64_t i = 0; i < iterations; ++i) {
+      logger->log_info(message);
+    }
+  };
+}
+
+} // anonymous namespace
+
+void register_logger_benchmarks(BenchmarkRunner &runner) {
+  runner.add_benchmark("Logger/log_info_console", []() {
+    return log_info_body(create_logger(LogDestination::CONSOLE));
+  });
+
+  runner.add_benchmark("Logger/log_info_file", []() {
+    // Start from an empty file so earlier runs do not affect the result
+    const std::string path = "ivv_benchmark_logger.log";
+    std::remove(path.c_str());
+    return log_info_body(create_logger(LogDestination::FILE, path));
+  });
+
+  // Messages below the minimum level are rejected before formatting
+  runner.add_benchmark("Logger/log_debug_filtered", []() {
+    auto logger = create_logger(LogDestination::CONSOLE);
+    return BenchmarkBody([logger](uint64_t iterations) {
+      const std::string message = "Benchmark debug message";
+      for (uint64_t i = 0; i < iterations; ++i) {
+        logger->log_debug(message);
+      }
+    });
+  });
+}
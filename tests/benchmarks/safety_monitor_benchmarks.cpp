@@ -0,0 +1,62 @@
+/**
+ * @file safety_monitor_benchmarks.cpp
+ * @brief SafetyMonitor benchmark suite
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "../../src/core/safety_monitor.h"
+#include "../benchmark_framework.h"
+#include <memory>
+#include <string>
+
+using namespace IVVFramework::Core;
+using namespace SimpleBenchmark;
+
+namespace {
+
+constexpr int kConstraintCount = 8;
+
+/// Monitor with kConstraintCount trivially safe constraints
+std::shared_ptr<SafetyMonitor> create_monitor() {
+  auto monitor = std::make_shared<SafetyMonitor>();
+  VerifierConfig config;
+  config.device_name = "benchmark_device";
+  monitor->initialize(config);
+
+  for (int i = 0; i < kConstraintCount; ++i) {
+    SafetyConstraint constraint;
+    constraint.name = "constraint_" + std::to_string(i);
+    constraint.type = SafetyConstraintType::TIMING_CONSTRAINT;
+    constraint.description = "Benchmark constraint";
+    constraint.check_function = []() { return SafetyResult::SAFE; };
+    monitor->register_constraint(constraint);
+  }
+  return monitor;
+}
+
+} // anonymous namespace
+
+void register_safety_monitor_benchmarks(BenchmarkRunner &runner) {
+  // One pass over all registered constraints
+  runner.add_benchmark("SafetyMonitor/check_system_safety", []() {
+    auto monitor = create_monitor();
+    return BenchmarkBody([monitor](uint64_t iterations) {
+      for (uint64_t i = 0; i < iterations; ++i) {
+        do_not_optimize(monitor->check_system_safety());
+      }
+    });
+  });
+
+  runner.add_benchmark("SafetyMonitor/check_constraint", []() {
+    auto monitor = create_monitor();
+    return BenchmarkBody([monitor](uint64_t iterations) {
+      const std::string name = "constraint_3";
+      for (uint64_t i = 0; i < iterations; ++i) {
+        do_not_optimize(monitor->check_constraint(name));
+      }
+    });
+  });
+}
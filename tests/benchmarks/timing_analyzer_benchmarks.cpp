@@ -0,0 +1,89 @@
+/**
+ * @file timing_analyzer_benchmarks.cpp
+ * @brief TimingAnalyzer benchmark suite
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "../../src/timing_analysis/timing_analyzer.h"
+#include "../benchmark_framework.h"
+#include <chrono>
+#include <memory>
+#include <string>
+
+using namespace IVVFramework::TimingAnalysis;
+using namespace SimpleBenchmark;
+
+namespace {
+
+std::shared_ptr<TimingAnalyzer> create_analyzer() {
+  std::shared_ptr<TimingAnalyzer> analyzer = TimingAnalyzer::create();
+  analyzer->initialize();
+  return analyzer;
+}
+
+/// Start/stop pairs on a registered component through the TimingSample API
+BenchmarkBody start_stop_body(std::shared_ptr<TimingAnalyzer> analyzer,
+                              ComponentId component) {
+  return [analyzer, component](uint64_t iterations) {
+    TimingSample sample;
+    for (uint64_t i = 0; i < iterations; ++i) {
+      analyzer->stop_measurement(analyzer->start_measurement(component),
+                                 sample);
+    }
+    do_not_optimize(sample.execution_time);
+  };
+}
+
+struct BenchmarkTimingTag {
+  static constexpr const char *name() { return "benchmark"; }
+};
+
+} // anonymous namespace
+
+void register_timing_analyzer_benchmarks(BenchmarkRunner &runner) {
+  runner.add_benchmark("TimingAnalyzer/start_stop", []() {
+    auto analyzer = create_analyzer();
+    return start_stop_body(analyzer,
+                           analyzer->register_component("benchmark"));
+  });
+
+  // Deadline evaluation against a published constraint
+  runner.add_benchmark("TimingAnalyzer/start_stop_constrained", []() {
+    auto analyzer = create_analyzer();
+    ComponentId component = analyzer->register_component("benchmark");
+    TimingConstraint constraint;
+    constraint.name = "benchmark";
+    constraint.deadline = std::chrono::seconds(1);
+    constraint.period = std::chrono::seconds(1);
+    constraint.max_jitter = std::chrono::milliseconds(1);
+    constraint.min_separation = std::chrono::nanoseconds(0);
+    analyzer->configure_constraints(component, constraint);
+    return start_stop_body(analyzer, component);
+  });
+
+  // Compile-time bound RAII timer
+  runner.add_benchmark("TimingAnalyzer/scoped_timing", []() {
+    auto analyzer = create_analyzer();
+    return BenchmarkBody([analyzer](uint64_t iterations) {
+      for (uint64_t i = 0; i < iterations; ++i) {
+        ScopedTiming<BenchmarkTimingTag> timing(*analyzer);
+      }
+    });
+  });
+
+  // Name lookup per start and a TimingMeasurement per stop
+  runner.add_benchmark("TimingAnalyzer/start_stop_by_name", []() {
+    auto analyzer = create_analyzer();
+    return BenchmarkBody([analyzer](uint64_t iterations) {
+      const std::string name = "benchmark";
+      for (uint64_t i = 0; i < iterations; ++i) {
+        TimingMeasurement measurement =
+            analyzer->stop_measurement(analyzer->start_measurement(name));
+        do_not_optimize(measurement.execution_time);
+      }
+    });
+  });
+}
@@ -0,0 +1,82 @@
+/**
+ * @file timing_history_benchmark.cpp
+ * @brief Stop latency of TimingAnalyzer as component history grows
+ *
+ * Records start/stop pairs for one component whose retention is sized to
+ * keep every sample, and reports the mean cost per pair for each block of
+ * samples. With incremental jitter tracking the cost per pair stays flat
+ * instead of growing with the number of retained samples.
+ *
+ * Usage: timing_history_benchmark [total_samples]
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "../../src/timing_analysis/timing_analyzer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace IVVFramework::TimingAnalysis;
+
+int main(int argc, char **argv) {
+  size_t total_samples = 2000000;
+  if (argc > 1) {
+    total_samples = static_cast<size_t>(std::strtoull(argv[1], nullptr, 10));
+  }
+  const size_t block_size = 100000;
+
+  auto analyzer = TimingAnalyzer::create();
+  if (!analyzer->initialize()) {
+    std::fprintf(stderr, "TimingAnalyzer initialization failed\n");
+    return 1;
+  }
+
+  ComponentId component = analyzer->register_component("history_component");
+  RetentionPolicy policy;
+  policy.max_samples = total_samples;
+  if (!analyzer->configure_retention(component, policy)) {
+    std::fprintf(stderr, "Failed to reserve history for %zu samples\n",
+                 total_samples);
+    return 1;
+  }
+
+  std::printf("TimingAnalyzer stop latency vs. history size (%zu samples)\n",
+              total_samples);
+  std::printf("%14s %14s\n", "history_size", "ns_per_pair");
+
+  TimingSample sample;
+  double first_block_ns = 0.0;
+  double last_block_ns = 0.0;
+
+  for (size_t recorded = 0; recorded < total_samples;) {
+    size_t block = (total_samples - recorded < block_size)
+                       ? total_samples - recorded
+                       : block_size;
+
+    auto begin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < block; ++i) {
+      analyzer->stop_measurement(analyzer->start_measurement(component),
+                                 sample);
+    }
+    // Pending completions are ingested here so their cost is counted
+    LatencyHistogram histogram;
+    analyzer->get_latency_histogram(component, histogram);
+    double elapsed_ns = std::chrono::duration<double, std::nano>(
+                            std::chrono::steady_clock::now() - begin)
+                            .count();
+
+    recorded += block;
+    last_block_ns = elapsed_ns / static_cast<double>(block);
+    if (first_block_ns == 0.0) {
+      first_block_ns = last_block_ns;
+    }
+    std::printf("%14zu %14.1f\n", recorded, last_block_ns);
+  }
+
+  std::printf("last/first block cost ratio: %.2f\n",
+              (first_block_ns > 0.0) ? last_block_ns / first_block_ns : 0.0);
+  return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file timing_report_benchmark.cpp
+ * @brief Report generation cost and its impact on stop_measurement latency
+ *
+ * Fills an analyzer with many components, then generates reports in a loop
+ * while a measurement thread records start/stop latency. Reports the mean
+ * report time and the worst stop_measurement latency seen with and without
+ * concurrent reporting.
+ *
+ * Usage: timing_report_benchmark [components] [samples_per_component]
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "../../src/timing_analysis/timing_analyzer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace IVVFramework::TimingAnalysis;
+
+namespace {
+
+/**
+ * @brief Worst start/stop pair latency while the flag stays set
+ */
+std::chrono::nanoseconds worst_stop_latency(TimingAnalyzer &analyzer,
+                                            ComponentId component,
+                                            const std::atomic<bool> &running) {
+  std::chrono::nanoseconds worst{0};
+  while (running.load(std::memory_order_relaxed)) {
+    auto begin = std::chrono::steady_clock::now();
+    analyzer.stop_measurement(analyzer.start_measurement(component));
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    worst = std::max(
+        worst, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+  }
+  return worst;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv) {
+  int component_count = 500;
+  int samples_per_component = 1000;
+  if (argc > 1) {
+    component_count = std::atoi(argv[1]);
+  }
+  if (argc > 2) {
+    samples_per_component = std::atoi(argv[2]);
+  }
+  const int reports = 20;
+
+  auto analyzer = TimingAnalyzer::create();
+  analyzer->initialize();
+  std::vector<ComponentId> components;
+  for (int c = 0; c < component_count; ++c) {
+    components.push_back(
+        analyzer->register_component("component_" + std::to_string(c)));
+    for (int i = 0; i < samples_per_component; ++i) {
+      analyzer->stop_measurement(
+          analyzer->start_measurement(components.back()));
+    }
+  }
+  ComponentId probe = analyzer->register_component("latency_probe");
+
+  std::printf("TimingAnalyzer report generation (%d components, %d samples "
+              "each)\n",
+              component_count, samples_per_component);
+
+  // Baseline stop latency without reports
+  std::atomic<bool> running{true};
+  std::chrono::nanoseconds idle_worst{0};
+  std::thread idle_probe(
+      [&]() { idle_worst = worst_stop_latency(*analyzer, probe, running); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  running.store(false);
+  idle_probe.join();
+
+  running.store(true);
+  std::chrono::nanoseconds report_worst{0};
+  std::thread report_probe(
+      [&]() { report_worst = worst_stop_latency(*analyzer, probe, running); });
+
+  double total_seconds = 0.0;
+  for (int r = 0; r < reports; ++r) {
+    auto begin = std::chrono::steady_clock::now();
+    auto report = analyzer->generate_report(false);
+    total_seconds += std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - begin)
+                         .count();
+    if (report.component_stats.empty()) {
+      std::fprintf(stderr, "Empty report\n");
+      return 1;
+    }
+  }
+  running.store(false);
+  report_probe.join();
+
+  std::printf("%-32s %12.3f ms\n", "mean report time",
+              total_seconds / reports * 1e3);
+  std::printf("%-32s %12.1f us\n", "worst stop latency (idle)",
+              static_cast<double>(idle_worst.count()) / 1e3);
+  std::printf("%-32s %12.1f us\n", "worst stop latency (reporting)",
+              static_cast<double>(report_worst.count()) / 1e3);
+  return 0;
+}
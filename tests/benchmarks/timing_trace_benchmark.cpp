@@ -0,0 +1,120 @@
+/**
+ * @file timing_trace_benchmark.cpp
+ * @brief Trace point throughput of TimingAnalyzer latency profiling
+ *
+ * Producer threads mark each item at an acquisition, decode and actuation
+ * trace point while a consumer thread periodically pairs the events with
+ * profile_latency(). Reports sustained trace events per second against the
+ * 1M events/s target and the cost of each profile_latency() call.
+ *
+ * Usage: timing_trace_benchmark [items_per_thread] [threads]
+ *
+ * @author IV&V Framework Team
+ * @version 1.0.0
+ * @date 2025-07-09
+ */
+
+#include "../../src/timing_analysis/timing_analyzer.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace IVVFramework::TimingAnalysis;
+
+int main(int argc, char **argv) {
+  uint64_t items_per_thread = 1000000;
+  size_t thread_count = 2;
+  if (argc > 1) {
+    items_per_thread = std::strtoull(argv[1], nullptr, 10);
+  }
+  if (argc > 2) {
+    thread_count = static_cast<size_t>(std::strtoull(argv[2], nullptr, 10));
+  }
+  const double target_events_per_second = 1.0e6;
+
+  auto analyzer = TimingAnalyzer::create();
+  if (!analyzer->initialize()) {
+    std::fprintf(stderr, "TimingAnalyzer initialization failed\n");
+    return 1;
+  }
+
+  ComponentId acquisition = analyzer->register_component("acquisition");
+  ComponentId decode = analyzer->register_component("decode");
+  ComponentId actuation = analyzer->register_component("actuation");
+
+  std::atomic<bool> producing{true};
+  std::atomic<uint64_t> profile_calls{0};
+  std::atomic<uint64_t> profile_ns{0};
+  std::atomic<uint64_t> matched{0};
+
+  // Consumer pairs acquisition and actuation events while producers run
+  std::thread consumer([&]() {
+    while (producing.load(std::memory_order_acquire)) {
+      auto begin = std::chrono::steady_clock::now();
+      auto stats =
+          analyzer->profile_latency("acquisition", "actuation", 1000);
+      auto elapsed = std::chrono::steady_clock::now() - begin;
+
+      profile_ns.fetch_add(static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+              .count()));
+      profile_calls.fetch_add(1);
+      matched.fetch_add(stats.measurement_count);
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  });
+
+  auto begin = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  for (size_t t = 0; t < thread_count; ++t) {
+    producers.emplace_back([&, t]() {
+      uint64_t base = static_cast<uint64_t>(t) * items_per_thread;
+      for (uint64_t item = 0; item < items_per_thread; ++item) {
+        analyzer->mark(acquisition, base + item);
+        analyzer->mark(decode, base + item);
+        analyzer->mark(actuation, base + item);
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  double elapsed_s = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - begin)
+                         .count();
+
+  producing.store(false, std::memory_order_release);
+  consumer.join();
+
+  auto final_stats = analyzer->profile_latency("acquisition", "actuation", 1000);
+
+  double events = static_cast<double>(items_per_thread) *
+                  static_cast<double>(thread_count) * 3.0;
+  double events_per_second = events / elapsed_s;
+  uint64_t calls = profile_calls.load();
+
+  std::printf("TimingAnalyzer trace throughput (%zu producers, %llu items "
+              "each)\n",
+              thread_count, static_cast<unsigned long long>(items_per_thread));
+  std::printf("trace events:          %.0f\n", events);
+  std::printf("events per second:     %.0f (target %.0f, %s)\n",
+              events_per_second, target_events_per_second,
+              events_per_second >= target_events_per_second ? "met"
+                                                            : "NOT met");
+  std::printf("profile_latency calls: %llu, mean %.1f us, %llu pairs\n",
+              static_cast<unsigned long long>(calls),
+              calls > 0 ? static_cast<double>(profile_ns.load()) /
+                              static_cast<double>(calls) / 1000.0
+                        : 0.0,
+              static_cast<unsigned long long>(matched.load()));
+  std::printf("final latency:         mean %lld ns, p99 %lld ns (%zu pairs)\n",
+              static_cast<long long>(final_stats.avg_execution_time.count()),
+              static_cast<long long>(final_stats.percentiles.empty()
+                                         ? 0
+                                         : final_stats.percentiles[1].count()),
+              final_stats.measurement_count);
+  return 0;
+}
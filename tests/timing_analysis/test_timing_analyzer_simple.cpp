@@ -9,10 +9,26 @@
  * @date 2025-07-09
  */
 
+#include "../../src/timing_analysis/history_tiers.h"
+#include "../../src/timing_analysis/jitter_tracker.h"
+#include "../../src/timing_analysis/realtime_thread.h"
+#include "../../src/timing_analysis/sample_history.h"
+#include "../../src/timing_analysis/shared_timing_segment.h"
+#include "../../src/timing_analysis/trace_file.h"
 #include "../../src/timing_analysis/timing_analyzer.h"
 #include "../simple_test_framework.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <numeric>
+#include <string>
+#include <sys/wait.h>
 #include <thread>
+#include <unistd.h>
+#include <vector>
 
 using namespace IVVFramework::TimingAnalysis;
 
@@ -207,6 +223,1759 @@ void test_constraint_verification() {
             << std::endl;
 }
 
+void test_concurrent_measurements() {
+  std::cout << "Testing concurrent measurements..." << std::endl;
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+
+  constexpr int kThreads = 4;
+  constexpr int kMeasurementsPerThread = 1000;
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < kThreads; ++t) {
+    workers.emplace_back([&analyzer]() {
+      for (int i = 0; i < kMeasurementsPerThread; ++i) {
+        auto id = analyzer->start_measurement("concurrent_test");
+        auto result = analyzer->stop_measurement(id);
+        if (result.task_name != "concurrent_test") {
+          throw std::runtime_error("Unexpected task name");
+        }
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  // Measurement started on one thread and stopped on another; the stop
+  // leaves its warning to the violation dispatcher
+  auto before = analyzer->get_violation_dispatch_statistics();
+  uint64_t handoff_id = analyzer->start_measurement("concurrent_test");
+  TimingMeasurement handoff_result;
+  std::thread stopper([&]() {
+    handoff_result = analyzer->stop_measurement(handoff_id);
+  });
+  stopper.join();
+  ASSERT_TRUE(handoff_result.task_name == "concurrent_test");
+  ASSERT_TRUE(analyzer->flush_violations());
+  auto after = analyzer->get_violation_dispatch_statistics();
+  ASSERT_EQ(before.queued + 1, after.queued);
+  ASSERT_EQ(before.dispatched + 1, after.dispatched);
+
+  // A measurement ID can only be stopped once
+  auto repeat = analyzer->stop_measurement(handoff_id);
+  ASSERT_TRUE(repeat.task_name == "NOT_FOUND");
+
+  // A start with all of the thread's 256 slots busy fails and is counted
+  std::vector<uint64_t> open_ids;
+  for (int i = 0; i < 256; ++i) {
+    open_ids.push_back(analyzer->start_measurement("slot_test"));
+    ASSERT_TRUE(open_ids.back() != 0);
+  }
+  ASSERT_EQ(static_cast<uint64_t>(0),
+            analyzer->start_measurement("slot_test"));
+  ASSERT_EQ(static_cast<uint64_t>(1),
+            analyzer->get_measurement_statistics().starts_rejected);
+  for (uint64_t id : open_ids) {
+    analyzer->stop_measurement(id);
+  }
+
+  auto stats = analyzer->estimate_wcet("concurrent_test", 0.99);
+  ASSERT_EQ(static_cast<size_t>(kThreads * kMeasurementsPerThread + 1),
+            stats.measurement_count);
+
+  std::cout << "✓ Concurrent measurement test passed (measurements: "
+            << stats.measurement_count << ")" << std::endl;
+}
+
+void test_concurrent_windowed_history() {
+  std::cout << "Testing windowed history across threads..." << std::endl;
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  ComponentId component = analyzer->register_component("interleaved_task");
+
+  // Two threads each ran the task every 10ms over the last two seconds,
+  // offset by 5ms; every sample sits in its thread's ring until the query
+  constexpr int kThreads = 2;
+  constexpr uint64_t kSamplesPerThread = 200;
+  constexpr uint64_t kPeriodNs = 10000000;
+  uint64_t now_ticks = analyzer->read_ticks();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < kThreads; ++t) {
+    workers.emplace_back([&, t]() {
+      for (uint64_t i = 0; i < kSamplesPerThread; ++i) {
+        uint64_t start = now_ticks - kSamplesPerThread * kPeriodNs +
+                         i * kPeriodNs + static_cast<uint64_t>(t) * 5000000;
+        analyzer->record_ticks(component, start, start + 1000000);
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  // The last second holds about half of each thread's samples, and the
+  // merged activations are evenly spaced
+  auto stats = analyzer->analyze_deadline_compliance("interleaved_task",
+                                                     std::chrono::seconds(1));
+  ASSERT_TRUE(stats.measurement_count >= 190 &&
+              stats.measurement_count <= 200);
+  auto report = analyzer->generate_report(true);
+  size_t retained = 0;
+  for (const auto &measurement : report.raw_measurements) {
+    if (measurement.task_name == "interleaved_task") {
+      ASSERT_TRUE(measurement.jitter < std::chrono::milliseconds(1));
+      ++retained;
+    }
+  }
+  ASSERT_EQ(static_cast<size_t>(kThreads) * kSamplesPerThread, retained);
+
+  std::cout << "✓ Windowed history across threads test passed" << std::endl;
+}
+
+void test_component_handles() {
+  std::cout << "Testing component handles..." << std::endl;
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+
+  ComponentId decoder = analyzer->register_component("decoder");
+  ASSERT_NE(INVALID_COMPONENT_ID, decoder);
+  ASSERT_EQ(decoder, analyzer->register_component("decoder"));
+  ASSERT_TRUE(analyzer->get_component_name(decoder) == "decoder");
+  ASSERT_EQ(INVALID_COMPONENT_ID, analyzer->register_component(""));
+  ASSERT_EQ(0u, analyzer->start_measurement(ComponentId{9999}));
+
+  TimingConstraint constraint;
+  constraint.name = "decoder";
+  constraint.deadline = std::chrono::microseconds(100);
+  constraint.period = std::chrono::milliseconds(10);
+  constraint.max_jitter = std::chrono::microseconds(50);
+  constraint.min_separation = std::chrono::nanoseconds(0);
+  ASSERT_TRUE(analyzer->configure_constraints(decoder, constraint));
+
+  TimingSample sample{};
+  uint64_t id = analyzer->start_measurement(decoder);
+  ASSERT_TRUE(id > 0);
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  ASSERT_TRUE(analyzer->stop_measurement(id, sample));
+  ASSERT_EQ(decoder, sample.component);
+  ASSERT_FALSE(sample.deadline_met);
+  ASSERT_FALSE(analyzer->stop_measurement(id, sample));
+
+  // The string API resolves to the same component
+  analyzer->measure_execution("decoder", []() {});
+  auto handle_sample = analyzer->measure_execution(decoder, []() {});
+  ASSERT_EQ(decoder, handle_sample.component);
+
+  auto stats = analyzer->estimate_wcet("decoder", 0.99);
+  ASSERT_EQ(static_cast<size_t>(3), stats.measurement_count);
+
+  std::cout << "✓ Component handle test passed" << std::endl;
+}
+
+void test_history_retention() {
+  std::cout << "Testing history retention..." << std::endl;
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+
+  RetentionPolicy policy;
+  policy.max_samples = 16;
+  ASSERT_TRUE(analyzer->configure_retention("retention_test", policy));
+
+  policy.max_samples = 0;
+  ASSERT_FALSE(analyzer->configure_retention("retention_test", policy));
+
+  for (int i = 0; i < 40; ++i) {
+    analyzer->measure_execution("retention_test", []() {});
+  }
+
+  // The WCET estimate keeps evicted samples; windowed queries do not
+  auto stats = analyzer->estimate_wcet("retention_test", 0.99);
+  ASSERT_EQ(static_cast<size_t>(40), stats.measurement_count);
+  ASSERT_EQ(static_cast<uint64_t>(24), stats.samples_evicted);
+
+  auto jitter_stats = analyzer->measure_jitter("retention_test", 1000);
+  ASSERT_EQ(static_cast<size_t>(16), jitter_stats.measurement_count);
+
+  // Time window: only samples within max_age of the newest are retained
+  RetentionPolicy window_policy;
+  window_policy.max_samples = 1024;
+  window_policy.max_age = std::chrono::milliseconds(20);
+  ASSERT_TRUE(analyzer->configure_retention("window_test", window_policy));
+
+  for (int i = 0; i < 5; ++i) {
+    analyzer->measure_execution("window_test", []() {});
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(40));
+  analyzer->measure_execution("window_test", []() {});
+
+  auto window_stats = analyzer->analyze_deadline_compliance(
+      "window_test", std::chrono::seconds(10));
+  ASSERT_EQ(static_cast<size_t>(1), window_stats.measurement_count);
+  ASSERT_EQ(static_cast<uint64_t>(5), window_stats.samples_evicted);
+
+  std::cout << "✓ History retention test passed" << std::endl;
+}
+
+void test_running_statistics() {
+  std::cout << "Testing running statistics..." << std::endl;
+
+  std::vector<std::chrono::nanoseconds> data;
+  for (int i = 100; i >= 1; --i) {
+    data.push_back(std::chrono::nanoseconds(i));
+  }
+  auto percentiles = TimingUtils::calculate_percentiles(data, {0.99, 0.5, 0.0});
+  ASSERT_EQ(static_cast<size_t>(3), percentiles.size());
+  ASSERT_TRUE(percentiles[0] == std::chrono::nanoseconds(99));
+  ASSERT_TRUE(percentiles[1] == std::chrono::nanoseconds(50));
+  ASSERT_TRUE(percentiles[2] == std::chrono::nanoseconds(1));
+  ASSERT_TRUE(TimingUtils::calculate_percentile(data, 0.5) ==
+              std::chrono::nanoseconds(50));
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+
+  RetentionPolicy policy;
+  policy.max_samples = 8;
+  ASSERT_TRUE(analyzer->configure_retention("running_test", policy));
+
+  analyzer->measure_execution("running_test", []() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  });
+  for (int i = 0; i < 20; ++i) {
+    analyzer->measure_execution("running_test", []() {});
+  }
+
+  // The report aggregates cover all samples, including evicted ones
+  auto report = analyzer->generate_report(false);
+  ASSERT_EQ(static_cast<size_t>(1), report.component_stats.size());
+  const auto &stats = report.component_stats[0];
+  ASSERT_EQ(static_cast<size_t>(21), stats.measurement_count);
+  ASSERT_EQ(static_cast<uint64_t>(13), stats.samples_evicted);
+  ASSERT_TRUE(stats.max_execution_time >= std::chrono::milliseconds(4));
+  ASSERT_TRUE(stats.min_execution_time <= stats.avg_execution_time);
+  ASSERT_EQ(static_cast<size_t>(3), stats.percentiles.size());
+
+  std::cout << "✓ Running statistics test passed" << std::endl;
+}
+
+void test_latency_histogram() {
+  std::cout << "Testing latency histogram..." << std::endl;
+
+  LatencyHistogram histogram;
+  ASSERT_TRUE(histogram.memory_footprint() <= 16 * 1024);
+  for (int64_t i = 1; i <= 10000; ++i) {
+    histogram.record(std::chrono::nanoseconds(i));
+  }
+  ASSERT_EQ(static_cast<uint64_t>(10000), histogram.total_count());
+  ASSERT_TRUE(histogram.min_value() == std::chrono::nanoseconds(1));
+  ASSERT_TRUE(histogram.max_value() == std::chrono::nanoseconds(10000));
+
+  // Values are exact below 2^precision_bits and within ~3% above
+  auto values = histogram.values_at_percentiles({0.5, 0.99, 0.00005});
+  ASSERT_TRUE(values[0] >= std::chrono::nanoseconds(5000) &&
+              values[0] <= std::chrono::nanoseconds(5160));
+  ASSERT_TRUE(values[1] >= std::chrono::nanoseconds(9900) &&
+              values[1] <= std::chrono::nanoseconds(10000));
+  ASSERT_TRUE(values[2] == std::chrono::nanoseconds(1));
+  ASSERT_TRUE(histogram.value_at_percentile(1.0) ==
+              std::chrono::nanoseconds(10000));
+
+  LatencyHistogram other;
+  other.record(std::chrono::minutes(5));
+  ASSERT_EQ(static_cast<uint64_t>(1), other.overflow_count());
+  ASSERT_TRUE(histogram.merge(other));
+  ASSERT_EQ(static_cast<uint64_t>(10001), histogram.total_count());
+  ASSERT_TRUE(histogram.max_value() == std::chrono::seconds(60));
+
+  HistogramConfig coarse;
+  coarse.precision_bits = 3;
+  ASSERT_FALSE(histogram.merge(LatencyHistogram(coarse)));
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  ComponentId component = analyzer->register_component("histogram_test");
+  ASSERT_TRUE(analyzer->configure_histogram(component, coarse));
+  for (int i = 0; i < 50; ++i) {
+    analyzer->measure_execution(component, []() {});
+  }
+
+  LatencyHistogram snapshot;
+  ASSERT_TRUE(analyzer->get_latency_histogram(component, snapshot));
+  ASSERT_EQ(static_cast<uint64_t>(50), snapshot.total_count());
+  ASSERT_EQ(3u, snapshot.config().precision_bits);
+
+  auto report = analyzer->generate_report(false);
+  ASSERT_EQ(static_cast<size_t>(1), report.component_stats.size());
+  const auto &stats = report.component_stats[0];
+  ASSERT_TRUE(stats.median_execution_time <= stats.p9999_execution_time);
+  ASSERT_TRUE(stats.p9999_execution_time <= stats.max_execution_time);
+
+  std::cout << "✓ Latency histogram test passed" << std::endl;
+}
+
+void test_incremental_jitter() {
+  std::cout << "Testing incremental jitter..." << std::endl;
+
+  // Intervals 10, 20, 10, 40, 10 (ns)
+  const int64_t offsets[] = {0, 10, 30, 40, 80, 90};
+  auto base = std::chrono::steady_clock::now();
+
+  JitterTracker unbounded;
+  JitterTracker windowed(3);
+  std::chrono::nanoseconds jitter{0};
+  std::chrono::nanoseconds windowed_jitter{0};
+  for (int64_t offset : offsets) {
+    auto start = base + std::chrono::nanoseconds(offset);
+    jitter = unbounded.add(start);
+    windowed_jitter = windowed.add(start);
+  }
+
+  // Mean 18: max(40 - 18, 18 - 10)
+  ASSERT_EQ(static_cast<uint64_t>(5), unbounded.interval_count());
+  ASSERT_TRUE(unbounded.mean_interval() == std::chrono::nanoseconds(18));
+  ASSERT_TRUE(jitter == std::chrono::nanoseconds(22));
+
+  // Last three intervals 10, 40, 10; mean 20: max(40 - 20, 20 - 10)
+  ASSERT_EQ(static_cast<uint64_t>(3), windowed.interval_count());
+  ASSERT_TRUE(windowed_jitter == std::chrono::nanoseconds(20));
+
+  // An activation older than the last one forms no interval
+  ASSERT_TRUE(unbounded.add(base) == std::chrono::nanoseconds(22));
+  ASSERT_EQ(static_cast<uint64_t>(5), unbounded.interval_count());
+
+  windowed.clear();
+  ASSERT_TRUE(windowed.add(base) == std::chrono::nanoseconds(0));
+  ASSERT_TRUE(windowed.jitter() == std::chrono::nanoseconds(0));
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  ComponentId component = analyzer->register_component("jitter_test");
+  RetentionPolicy policy;
+  policy.jitter_window = 4;
+  ASSERT_TRUE(analyzer->configure_retention(component, policy));
+
+  TimingSample sample;
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(analyzer->stop_measurement(
+        analyzer->start_measurement(component), sample));
+  }
+  analyzer->generate_report(false);
+
+  // Stops report the jitter of the last four intervals right away, whether
+  // or not the samples have been ingested yet
+  const int sleeps_ms[] = {1, 1, 4, 1, 2};
+  std::vector<std::chrono::steady_clock::time_point> starts;
+  for (int sleep_ms : sleeps_ms) {
+    ASSERT_TRUE(analyzer->stop_measurement(
+        analyzer->start_measurement(component), sample));
+    starts.push_back(sample.start_time);
+    std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+  }
+  ASSERT_TRUE(analyzer->stop_measurement(
+      analyzer->start_measurement(component), sample));
+  starts.push_back(sample.start_time);
+
+  std::vector<int64_t> intervals;
+  for (size_t i = starts.size() - 4; i < starts.size(); ++i) {
+    intervals.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            starts[i] - starts[i - 1])
+                            .count());
+  }
+  int64_t mean = std::accumulate(intervals.begin(), intervals.end(),
+                                 int64_t{0}) /
+                 4;
+  auto [shortest, longest] =
+      std::minmax_element(intervals.begin(), intervals.end());
+  ASSERT_TRUE(sample.jitter ==
+              std::chrono::nanoseconds(
+                  std::max(*longest - mean, mean - *shortest)));
+  ASSERT_TRUE(sample.jitter >= std::chrono::milliseconds(1));
+
+  std::cout << "✓ Incremental jitter test passed" << std::endl;
+}
+
+void test_tsc_clock_source() {
+  std::cout << "Testing TSC clock source..." << std::endl;
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize(ClockSource::TSC));
+
+  // Falls back to steady_clock where no invariant TSC exists; either way
+  // timestamps share the steady_clock time base
+  auto before = std::chrono::steady_clock::now();
+  auto timestamp = analyzer->get_precise_timestamp();
+  auto after = std::chrono::steady_clock::now();
+  ASSERT_TRUE(timestamp >= before - std::chrono::milliseconds(1));
+  ASSERT_TRUE(timestamp <= after + std::chrono::milliseconds(1));
+
+  TimingSample sample;
+  ComponentId component = analyzer->register_component("tsc_test");
+  uint64_t id = analyzer->start_measurement(component);
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  ASSERT_TRUE(analyzer->stop_measurement(id, sample));
+  ASSERT_TRUE(sample.execution_time >= std::chrono::milliseconds(4));
+  ASSERT_TRUE(sample.execution_time < std::chrono::seconds(1));
+  ASSERT_TRUE(sample.end_time - sample.start_time >=
+              std::chrono::milliseconds(4));
+
+  auto stats = analyzer->estimate_wcet("tsc_test", 0.99);
+  ASSERT_EQ(static_cast<size_t>(1), stats.measurement_count);
+
+  auto steady = TimingAnalyzer::create();
+  ASSERT_TRUE(steady->initialize());
+  ASSERT_TRUE(steady->get_clock_source() == ClockSource::STEADY_CLOCK);
+
+  std::cout << "✓ TSC clock source test passed ("
+            << ((analyzer->get_clock_source() == ClockSource::TSC)
+                    ? "TSC"
+                    : "steady_clock fallback")
+            << ")" << std::endl;
+}
+
+void test_columnar_history() {
+  std::cout << "Testing columnar history..." << std::endl;
+
+  RetentionPolicy policy;
+  policy.max_samples = 100;
+  SampleHistory history(7, policy);
+
+  auto base = std::chrono::steady_clock::now();
+  for (int64_t i = 0; i < 150; ++i) {
+    TimingSample sample{};
+    sample.start_time = base + std::chrono::microseconds(i);
+    sample.execution_time = std::chrono::nanoseconds(i);
+    sample.deadline_met = (i % 3) != 0;
+    history.append(sample);
+  }
+
+  // Samples 50..149 are retained and the ring has wrapped
+  ASSERT_EQ(static_cast<size_t>(100), history.size());
+  ASSERT_EQ(static_cast<uint64_t>(50), history.evicted_count());
+  ASSERT_EQ(static_cast<int64_t>(50), history.execution_ns(0));
+  ASSERT_EQ(static_cast<uint64_t>(33), history.deadline_misses(0));
+  ASSERT_EQ(static_cast<uint64_t>(1), history.deadline_misses(97));
+
+  auto slices = history.execution_times(10);
+  ASSERT_EQ(static_cast<size_t>(90), slices.first_size + slices.second_size);
+  int64_t expected = 60;
+  bool ordered = true;
+  slices.for_each([&](int64_t value) { ordered &= (value == expected++); });
+  ASSERT_TRUE(ordered);
+
+  TimingSample sample = history.at(99);
+  ASSERT_EQ(static_cast<ComponentId>(7), sample.component);
+  ASSERT_TRUE(sample.execution_time == std::chrono::nanoseconds(149));
+  ASSERT_TRUE(sample.end_time - sample.start_time ==
+              std::chrono::nanoseconds(149));
+  ASSERT_FALSE(history.at(97).deadline_met);
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  analyzer->configure_retention("raw_test", policy);
+  for (int i = 0; i < 5; ++i) {
+    analyzer->measure_execution("raw_test", []() {});
+  }
+  ASSERT_TRUE(analyzer->generate_report(false).raw_measurements.empty());
+  auto report = analyzer->generate_report(true);
+  ASSERT_EQ(static_cast<size_t>(5), report.raw_measurements.size());
+  ASSERT_TRUE(report.raw_measurements[0].task_name == "raw_test");
+
+  std::cout << "✓ Columnar history test passed" << std::endl;
+}
+
+void test_time_indexed_history() {
+  std::cout << "Testing time-indexed history..." << std::endl;
+
+  RetentionPolicy policy;
+  policy.max_samples = 100;
+  policy.aggregate_interval = std::chrono::microseconds(10);
+  SampleHistory history(1, policy);
+
+  // One sample per microsecond, so ten samples per bucket
+  auto base = std::chrono::steady_clock::time_point(std::chrono::seconds(1));
+  for (int64_t i = 0; i < 155; ++i) {
+    TimingSample sample{};
+    sample.start_time = base + std::chrono::microseconds(i);
+    sample.execution_time = std::chrono::nanoseconds(1000 + (i % 7) * 10);
+    sample.deadline_met = (i % 4) != 0;
+    history.append(sample);
+  }
+
+  // Samples 55..154 are retained; the oldest bucket is partially evicted
+  ASSERT_EQ(static_cast<size_t>(11), history.bucket_count());
+  int64_t base_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        base.time_since_epoch())
+                        .count();
+  ASSERT_EQ(static_cast<size_t>(0), history.lower_bound(base_ns));
+  ASSERT_EQ(static_cast<size_t>(45), history.lower_bound(base_ns + 100000));
+  ASSERT_EQ(static_cast<size_t>(100), history.lower_bound(base_ns + 1000000));
+
+  bool matches = true;
+  for (size_t first : {size_t{0}, size_t{3}, size_t{5}, size_t{45}, size_t{99}}) {
+    RunningStatistics expected;
+    for (size_t i = first; i < history.size(); ++i) {
+      expected.add(history.execution_ns(i), history.deadline_met(i));
+    }
+    RunningStatistics actual = history.aggregate(first);
+    matches &= actual.count == expected.count &&
+               actual.deadline_misses == expected.deadline_misses &&
+               actual.min_ns == expected.min_ns &&
+               actual.max_ns == expected.max_ns &&
+               std::abs(actual.mean_ns - expected.mean_ns) < 1e-6;
+  }
+  ASSERT_TRUE(matches);
+
+  // Changing the bucket width re-aggregates the retained samples
+  policy.aggregate_interval = std::chrono::microseconds(50);
+  history.set_policy(policy);
+  ASSERT_EQ(static_cast<size_t>(3), history.bucket_count());
+  ASSERT_EQ(static_cast<uint64_t>(100), history.aggregate(0).count);
+
+  std::cout << "✓ Time-indexed history test passed" << std::endl;
+}
+
+void test_out_of_order_history() {
+  std::cout << "Testing out-of-order history appends..." << std::endl;
+
+  RetentionPolicy policy;
+  policy.max_samples = 50;
+  policy.aggregate_interval = std::chrono::microseconds(10);
+  SampleHistory history(1, policy);
+
+  // One sample per microsecond from two threads, drained in blocks of
+  // twenty: each thread's ten samples, then the other's
+  auto base = std::chrono::steady_clock::time_point(std::chrono::seconds(1));
+  for (int64_t block = 0; block < 4; ++block) {
+    for (int64_t parity = 0; parity < 2; ++parity) {
+      for (int64_t k = 0; k < 10; ++k) {
+        int64_t i = block * 20 + 2 * k + parity;
+        TimingSample sample{};
+        sample.start_time = base + std::chrono::microseconds(i);
+        sample.execution_time = std::chrono::nanoseconds(1000 + (i % 7) * 10);
+        sample.deadline_met = (i % 4) != 0;
+        history.append(sample);
+      }
+    }
+  }
+
+  // The newest fifty starts are retained in start order
+  ASSERT_EQ(static_cast<size_t>(50), history.size());
+  ASSERT_EQ(static_cast<uint64_t>(30), history.evicted_count());
+  bool ordered = true;
+  for (size_t i = 0; i < history.size(); ++i) {
+    ordered &= history.at(i).start_time ==
+               base + std::chrono::microseconds(30 + static_cast<int64_t>(i));
+  }
+  ASSERT_TRUE(ordered);
+  int64_t base_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        base.time_since_epoch())
+                        .count();
+  ASSERT_EQ(static_cast<size_t>(30), history.lower_bound(base_ns + 60000));
+
+  bool matches = true;
+  for (size_t first : {size_t{0}, size_t{4}, size_t{10}, size_t{33}}) {
+    RunningStatistics expected;
+    for (size_t i = first; i < history.size(); ++i) {
+      expected.add(history.execution_ns(i), history.deadline_met(i));
+    }
+    RunningStatistics actual = history.aggregate(first);
+    matches &= actual.count == expected.count &&
+               actual.deadline_misses == expected.deadline_misses &&
+               actual.min_ns == expected.min_ns &&
+               actual.max_ns == expected.max_ns &&
+               std::abs(actual.mean_ns - expected.mean_ns) < 1e-6;
+  }
+  ASSERT_TRUE(matches);
+
+  // A sample older than max_age relative to the newest one is not retained
+  policy.max_age = std::chrono::microseconds(20);
+  history.set_policy(policy);
+  TimingSample late{};
+  late.start_time = base + std::chrono::microseconds(50);
+  late.execution_time = std::chrono::nanoseconds(1000);
+  history.append(late);
+  ASSERT_EQ(static_cast<size_t>(21), history.size());
+  ASSERT_TRUE(history.at(0).start_time ==
+              base + std::chrono::microseconds(59));
+
+  std::cout << "✓ Out-of-order history test passed" << std::endl;
+}
+
+void test_latency_profiling() {
+  std::cout << "Testing end-to-end latency profiling..." << std::endl;
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+
+  // Items are acquired on one thread and decoded/actuated on another
+  const uint64_t item_count = 200;
+  std::thread acquisition([&analyzer]() {
+    for (uint64_t item = 1; item <= item_count; ++item) {
+      analyzer->mark("acquisition", item);
+    }
+  });
+  acquisition.join();
+
+  std::thread pipeline([&analyzer]() {
+    for (uint64_t item = 1; item <= item_count; ++item) {
+      analyzer->mark("decode", item);
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+      analyzer->mark("actuation", item);
+    }
+  });
+  pipeline.join();
+
+  auto stats = analyzer->profile_latency("acquisition", "actuation", 100);
+  ASSERT_EQ(std::string("acquisition_to_actuation"), stats.component_name);
+  ASSERT_EQ(static_cast<size_t>(100), stats.measurement_count);
+  ASSERT_TRUE(stats.min_execution_time.count() > 0);
+  ASSERT_TRUE(stats.max_execution_time >= stats.min_execution_time);
+
+  // Decode to actuation spans at least the 10us sleep
+  stats = analyzer->profile_latency("decode", "actuation", 1000);
+  ASSERT_EQ(static_cast<size_t>(item_count), stats.measurement_count);
+  ASSERT_TRUE(stats.min_execution_time >= std::chrono::microseconds(10));
+
+  // Unknown points and unmatched correlation ids yield no samples
+  ASSERT_EQ(static_cast<size_t>(0),
+            analyzer->profile_latency("decode", "missing", 10).measurement_count);
+  analyzer->mark("acquisition", item_count + 1000);
+  stats = analyzer->profile_latency("actuation", "acquisition", 10);
+  ASSERT_EQ(static_cast<size_t>(0), stats.measurement_count);
+
+  analyzer->clear_measurements();
+  ASSERT_EQ(static_cast<size_t>(0),
+            analyzer->profile_latency("decode", "actuation", 10).measurement_count);
+
+  std::cout << "✓ Latency profiling test passed" << std::endl;
+}
+
+void test_resource_sampling() {
+  std::cout << "Testing built-in resource sampling..." << std::endl;
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  ASSERT_TRUE(analyzer->configure_sampling_rate(100.0));
+
+  // A busy thread keeps process CPU above zero during the window
+  std::atomic<bool> running{true};
+  std::thread busy([&running]() {
+    volatile uint64_t counter = 0;
+    while (running.load(std::memory_order_relaxed)) {
+      counter = counter + 1;
+    }
+  });
+
+  auto cpu = analyzer->monitor_resource_utilization(
+      "CPU", std::chrono::milliseconds(200));
+  running.store(false);
+  busy.join();
+
+  ASSERT_EQ(std::string("CPU"), cpu.resource_name);
+  ASSERT_TRUE(cpu.utilization_samples.size() >= 10);
+  ASSERT_TRUE(cpu.average_utilization > 0.0);
+  ASSERT_TRUE(cpu.peak_utilization >= cpu.average_utilization);
+  ASSERT_TRUE(cpu.peak_rss_bytes > 0);
+
+  // The test thread and the busy thread are observed; the sampler is not
+  ASSERT_TRUE(cpu.thread_utilization.size() >= 2);
+  double busiest = 0.0;
+  for (const auto &thread : cpu.thread_utilization) {
+    busiest = std::max(busiest, thread.average_cpu);
+  }
+  ASSERT_TRUE(busiest > 10.0);
+
+  auto memory = analyzer->monitor_resource_utilization(
+      "memory", std::chrono::milliseconds(50));
+  ASSERT_TRUE(memory.average_utilization > 0.0);
+  ASSERT_TRUE(memory.average_utilization < 100.0);
+  ASSERT_FALSE(memory.exceeds_safety_threshold);
+
+  std::cout << "✓ Resource sampling test passed" << std::endl;
+}
+
+void test_performance_counters() {
+  std::cout << "Testing performance counter capture..." << std::endl;
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  ComponentId component = analyzer->register_component("counted_component");
+
+  // Counters are opt-in
+  TimingSample sample;
+  ASSERT_TRUE(analyzer->stop_measurement(
+      analyzer->start_measurement(component), sample));
+  ASSERT_FALSE(sample.counters.valid);
+
+  if (!analyzer->enable_performance_counters(true)) {
+    std::cout << "  perf_event_open unavailable; skipping capture checks"
+              << std::endl;
+    return;
+  }
+
+  // Sleeping inside the measurement forces context switches
+  const int sample_count = 5;
+  for (int i = 0; i < sample_count; ++i) {
+    uint64_t id = analyzer->start_measurement(component);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_TRUE(analyzer->stop_measurement(id, sample));
+    ASSERT_TRUE(sample.counters.valid);
+    ASSERT_TRUE(sample.counters.task_clock_ns > 0);
+    ASSERT_TRUE(std::chrono::nanoseconds(sample.counters.task_clock_ns) <
+                sample.execution_time);
+  }
+
+  auto stats = analyzer->analyze_deadline_compliance(
+      "counted_component", std::chrono::seconds(60));
+  ASSERT_EQ(static_cast<uint64_t>(sample_count), stats.counters.sample_count);
+  ASSERT_TRUE(stats.counters.total.context_switches >= 1);
+  ASSERT_TRUE(stats.counters.maximum.task_clock_ns > 0);
+
+  // A measurement stopped on another thread carries no counters
+  uint64_t id = analyzer->start_measurement(component);
+  std::thread([&]() { analyzer->stop_measurement(id, sample); }).join();
+  ASSERT_FALSE(sample.counters.valid);
+
+  ASSERT_TRUE(analyzer->enable_performance_counters(false));
+  ASSERT_TRUE(analyzer->stop_measurement(
+      analyzer->start_measurement(component), sample));
+  ASSERT_FALSE(sample.counters.valid);
+
+  std::cout << "✓ Performance counter test passed" << std::endl;
+}
+
+void test_trace_file_round_trip() {
+  std::cout << "Testing binary trace file recording..." << std::endl;
+
+  const std::string path = "timing_trace_test.ivvtrace";
+  const int sample_count = 300;
+
+  {
+    auto recorder = TimingAnalyzer::create();
+    ASSERT_TRUE(recorder->initialize());
+    ASSERT_TRUE(recorder->start_trace_recording(path));
+
+    TimingSample sample;
+    for (int i = 0; i < sample_count; ++i) {
+      const char *name = (i % 3 == 0) ? "trace_decoder" : "trace_filter";
+      recorder->stop_measurement(recorder->start_measurement(name), sample);
+    }
+    recorder->stop_trace_recording();
+  }
+
+  TraceFileReader reader;
+  ASSERT_TRUE(reader.open(path));
+  ASSERT_EQ(static_cast<uint64_t>(sample_count), reader.record_count());
+  ASSERT_EQ(static_cast<size_t>(2), reader.components().size());
+  ASSERT_EQ(std::string("trace_decoder"), reader.components()[0].name);
+  reader.close();
+
+  // A fresh analyzer analyzes the recorded samples
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  analyzer->register_component("unrelated_component");
+  ASSERT_TRUE(analyzer->import_trace(path));
+  auto report = analyzer->generate_report(false);
+  size_t imported = 0;
+  for (const auto &stats : report.component_stats) {
+    imported += stats.measurement_count;
+  }
+  ASSERT_EQ(static_cast<size_t>(sample_count), imported);
+  ASSERT_FALSE(analyzer->import_trace("missing_trace.ivvtrace"));
+
+  // Files whose writer never closed them end at the first empty record
+  TraceFileWriter writer;
+  ASSERT_TRUE(writer.open(path, 4096));
+  ASSERT_TRUE(writer.define_component(7, "open_component"));
+  TimingSample sample{};
+  sample.component = 7;
+  sample.execution_time = std::chrono::microseconds(5);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(writer.append(make_trace_record(sample)));
+  }
+  writer.flush();
+  ASSERT_TRUE(reader.open(path));
+  ASSERT_EQ(static_cast<uint64_t>(1000), reader.record_count());
+  ASSERT_EQ(static_cast<int64_t>(5000), reader.records()[999].execution_ns);
+  ASSERT_TRUE((reader.records()[0].flags & kTraceFlagDeadlineMet) != 0);
+  reader.close();
+  writer.close();
+
+  // Headers placing the dictionary past the end of the file or the records
+  // off their alignment are rejected
+  auto patch_header = [&path](long offset, uint64_t value) {
+    std::FILE *file = std::fopen(path.c_str(), "r+b");
+    ASSERT_TRUE(file != nullptr);
+    ASSERT_EQ(0, std::fseek(file, offset, SEEK_SET));
+    ASSERT_EQ(static_cast<size_t>(1),
+              std::fwrite(&value, sizeof(value), 1, file));
+    std::fclose(file);
+  };
+  constexpr long kDictionaryOffsetField = 24;
+  constexpr long kDataOffsetField = 32;
+  patch_header(kDictionaryOffsetField, uint64_t{1} << 40);
+  ASSERT_FALSE(reader.open(path));
+  patch_header(kDictionaryOffsetField, 4096);
+  ASSERT_TRUE(reader.open(path));
+  reader.close();
+  patch_header(kDataOffsetField, 4096 + 4);
+  ASSERT_FALSE(reader.open(path));
+
+  std::remove(path.c_str());
+  std::cout << "✓ Trace file round trip test passed" << std::endl;
+}
+
+void test_trace_replay() {
+  std::cout << "Testing parallel offline trace replay..." << std::endl;
+
+  // Four components alternating 1us and 3us samples, all recorded as met;
+  // each block of eight records is written in reverse start order
+  const std::string path = "timing_replay_test.ivvtrace";
+  const char *names[] = {"replay_a", "replay_b", "replay_c", "replay_d"};
+  {
+    TraceFileWriter writer;
+    ASSERT_TRUE(writer.open(path, 4096));
+    for (ComponentId id = 1; id <= 4; ++id) {
+      ASSERT_TRUE(writer.define_component(id, names[id - 1]));
+    }
+    for (int64_t i = 0; i < 4000; ++i) {
+      TraceRecord record;
+      record.component = static_cast<ComponentId>(i % 4 + 1);
+      record.flags = kTraceFlagDeadlineMet;
+      record.start_ns = (i ^ 7) * 1000;
+      record.execution_ns = ((i / 4) % 2 == 0) ? 1000 : 3000;
+      ASSERT_TRUE(writer.append(record));
+    }
+  }
+
+  TimingConstraint constraint;
+  constraint.name = "replay_constraint";
+  constraint.deadline = std::chrono::microseconds(2);
+  constraint.period = std::chrono::milliseconds(1);
+  constraint.max_jitter = std::chrono::microseconds(10);
+  constraint.min_separation = std::chrono::nanoseconds(0);
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  ASSERT_TRUE(analyzer->configure_constraints("replay_a", constraint));
+
+  TraceReplayOptions options;
+  options.worker_threads = 3;
+  ASSERT_TRUE(analyzer->import_trace(path, options));
+
+  // replay_a is judged against the 2us deadline, the others keep the
+  // recorded outcome
+  auto report = analyzer->generate_report(false);
+  ASSERT_EQ(static_cast<size_t>(4), report.component_stats.size());
+  for (const auto &stats : report.component_stats) {
+    ASSERT_EQ(static_cast<size_t>(1000), stats.measurement_count);
+    ASSERT_EQ(std::chrono::nanoseconds(3000), stats.max_execution_time);
+    double expected_miss_rate = (stats.component_name == "replay_a") ? 0.5
+                                                                     : 0.0;
+    ASSERT_TRUE(std::abs(stats.deadline_miss_rate - expected_miss_rate) <
+                1e-9);
+  }
+  ASSERT_FALSE(analyzer->verify_timing_constraints());
+
+  // Each component's records are replayed in start order, 4us apart
+  report = analyzer->generate_report(true);
+  ASSERT_FALSE(report.raw_measurements.empty());
+  for (const auto &measurement : report.raw_measurements) {
+    ASSERT_EQ(std::chrono::nanoseconds(0), measurement.jitter);
+  }
+
+  // Re-run the same trace against a relaxed constraint set
+  analyzer->clear_measurements();
+  constraint.deadline = std::chrono::microseconds(5);
+  ASSERT_TRUE(analyzer->configure_constraints("replay_a", constraint));
+  ASSERT_TRUE(analyzer->import_trace(path));
+  ASSERT_TRUE(analyzer->verify_timing_constraints());
+
+  // Two dictionary ids naming one component are replayed as one
+  {
+    TraceFileWriter writer;
+    ASSERT_TRUE(writer.open(path, 4096));
+    ASSERT_TRUE(writer.define_component(1, "replay_shared"));
+    ASSERT_TRUE(writer.define_component(2, "replay_shared"));
+    for (int64_t i = 0; i < 1000; ++i) {
+      TraceRecord record;
+      record.component = static_cast<ComponentId>(i % 2 + 1);
+      record.start_ns = i * 1000;
+      record.execution_ns = 500;
+      ASSERT_TRUE(writer.append(record));
+    }
+  }
+  options.worker_threads = 2;
+  ASSERT_TRUE(analyzer->import_trace(path, options));
+  auto shared = analyzer->estimate_wcet("replay_shared", 0.99);
+  ASSERT_EQ(static_cast<size_t>(1000), shared.measurement_count);
+  report = analyzer->generate_report(true);
+  for (const auto &measurement : report.raw_measurements) {
+    if (measurement.task_name == "replay_shared") {
+      ASSERT_EQ(std::chrono::nanoseconds(0), measurement.jitter);
+    }
+  }
+
+  std::remove(path.c_str());
+  std::cout << "✓ Trace replay test passed" << std::endl;
+}
+
+void test_parallel_report() {
+  std::cout << "Testing parallel report generation..." << std::endl;
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+
+  constexpr int kComponents = 32;
+  constexpr int kSamplesPerComponent = 100;
+  constexpr int kBackgroundSamples = 20000;
+  std::vector<ComponentId> components;
+  for (int c = 0; c < kComponents; ++c) {
+    components.push_back(
+        analyzer->register_component("report_" + std::to_string(c)));
+    if (c == 0) {
+      // The busy component evicts; both queries still cover every sample
+      RetentionPolicy policy;
+      policy.max_samples = 1024;
+      ASSERT_TRUE(analyzer->configure_retention(components.back(), policy));
+    }
+    for (int i = 0; i < kSamplesPerComponent; ++i) {
+      analyzer->stop_measurement(
+          analyzer->start_measurement(components.back()));
+    }
+  }
+
+  // Measurements keep completing while reports are generated
+  std::atomic<bool> producing{true};
+  std::thread producer([&]() {
+    for (int i = 0; i < kBackgroundSamples; ++i) {
+      analyzer->stop_measurement(analyzer->start_measurement(components[0]));
+    }
+    producing.store(false);
+  });
+  for (int r = 0; r < 5 || producing.load(); ++r) {
+    auto report = analyzer->generate_report(true);
+    ASSERT_EQ(static_cast<size_t>(kComponents), report.component_stats.size());
+  }
+  producer.join();
+
+  // Statistics keep component order and match the per-component queries
+  auto report = analyzer->generate_report(true);
+  ASSERT_EQ(static_cast<size_t>(kComponents), report.component_stats.size());
+  size_t retained = 0;
+  for (int c = 0; c < kComponents; ++c) {
+    const auto &stats = report.component_stats[static_cast<size_t>(c)];
+    auto expected = analyzer->estimate_wcet("report_" + std::to_string(c));
+    ASSERT_TRUE(stats.component_name == expected.component_name);
+    ASSERT_EQ(expected.measurement_count, stats.measurement_count);
+    ASSERT_EQ(expected.max_execution_time, stats.max_execution_time);
+    ASSERT_EQ(expected.samples_evicted, stats.samples_evicted);
+    ASSERT_EQ(expected.wcet_estimate, stats.wcet_estimate);
+    ASSERT_TRUE(expected.percentiles == stats.percentiles);
+    retained += stats.measurement_count - stats.samples_evicted;
+  }
+  // A sample that found its completion ring full is dropped and counted
+  uint64_t dropped = analyzer->get_measurement_statistics().samples_dropped;
+  const auto &busy = report.component_stats[0];
+  ASSERT_EQ(static_cast<size_t>(kSamplesPerComponent + kBackgroundSamples) -
+                dropped,
+            busy.measurement_count);
+  ASSERT_TRUE(busy.samples_evicted > 0);
+
+  // Raw measurements are grouped by component in the same order
+  ASSERT_EQ(retained, report.raw_measurements.size());
+  ASSERT_TRUE(report.raw_measurements.front().task_name == "report_0");
+  ASSERT_TRUE(report.raw_measurements.back().task_name ==
+              "report_" + std::to_string(kComponents - 1));
+
+  std::cout << "✓ Parallel report test passed" << std::endl;
+}
+
+void test_violation_dispatch() {
+  std::cout << "Testing asynchronous violation dispatch..." << std::endl;
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+
+  // Every measurement misses a 1ns deadline
+  TimingConstraint constraint;
+  constraint.name = "dispatch_constraint";
+  constraint.deadline = std::chrono::nanoseconds(1);
+  constraint.period = std::chrono::milliseconds(1);
+  constraint.max_jitter = std::chrono::milliseconds(1);
+  constraint.min_separation = std::chrono::nanoseconds(0);
+  ComponentId component = analyzer->register_component("dispatch_test");
+  ASSERT_TRUE(analyzer->configure_constraints(component, constraint));
+
+  // The callback can hold up the dispatcher thread to fill the queue
+  const std::thread::id test_thread = std::this_thread::get_id();
+  std::atomic<int> calls{0};
+  std::atomic<int> dispatcher_calls{0};
+  std::atomic<bool> block_dispatcher{false};
+  analyzer->set_verification_callback(
+      [&](const TimingMeasurement &measurement, const TimingConstraint &) {
+        calls.fetch_add(1);
+        if (std::this_thread::get_id() != test_thread) {
+          dispatcher_calls.fetch_add(1);
+          while (block_dispatcher.load()) {
+            std::this_thread::yield();
+          }
+        }
+        return measurement.deadline_met;
+      });
+
+  auto miss = [&]() {
+    TimingSample sample;
+    analyzer->stop_measurement(analyzer->start_measurement(component), sample);
+    return !sample.deadline_met;
+  };
+
+  // Violations are processed off the stopping thread
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(miss());
+  }
+  ASSERT_TRUE(analyzer->flush_violations(std::chrono::seconds(5)));
+  auto stats = analyzer->get_violation_dispatch_statistics();
+  ASSERT_EQ(static_cast<uint64_t>(100), stats.queued);
+  ASSERT_EQ(static_cast<uint64_t>(100), stats.dispatched);
+  ASSERT_EQ(static_cast<uint64_t>(100), stats.safety_violations);
+  ASSERT_EQ(100, dispatcher_calls.load());
+
+  // A stalled dispatcher fills the ring; the default policy drops. The
+  // guard releases the dispatcher if an assertion fails, so the analyzer
+  // can still shut down.
+  struct Release {
+    std::atomic<bool> &flag;
+    ~Release() { flag.store(false); }
+  } release{block_dispatcher};
+  block_dispatcher.store(true);
+  miss();
+  while (dispatcher_calls.load() < 101) {
+    std::this_thread::yield();
+  }
+  for (int i = 0; i < 1100; ++i) {
+    miss();
+  }
+  stats = analyzer->get_violation_dispatch_statistics();
+  ASSERT_TRUE(stats.dropped > 0);
+  ASSERT_EQ(static_cast<uint64_t>(101 + 1100), stats.queued + stats.dropped);
+
+  // The inline policy runs the overflow on the stopping thread
+  ASSERT_TRUE(analyzer->configure_violation_dispatch(
+      ViolationOverflowPolicy::DISPATCH_INLINE));
+  for (int i = 0; i < 10; ++i) {
+    miss();
+  }
+  stats = analyzer->get_violation_dispatch_statistics();
+  ASSERT_EQ(static_cast<uint64_t>(10), stats.dispatched_inline);
+  ASSERT_EQ(101 + 10, calls.load());
+
+  block_dispatcher.store(false);
+  ASSERT_TRUE(analyzer->flush_violations(std::chrono::seconds(5)));
+  stats = analyzer->get_violation_dispatch_statistics();
+  ASSERT_EQ(stats.queued, stats.dispatched);
+  ASSERT_EQ(static_cast<uint64_t>(1211), stats.dispatched +
+                                             stats.dispatched_inline +
+                                             stats.dropped);
+  ASSERT_EQ(stats.dispatched + stats.dispatched_inline,
+            static_cast<uint64_t>(calls.load()));
+
+  std::cout << "✓ Violation dispatch test passed (dropped: " << stats.dropped
+            << ")" << std::endl;
+}
+
+void test_constraint_updates() {
+  std::cout << "Testing runtime constraint updates..." << std::endl;
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+
+  TimingConstraint strict;
+  strict.name = "strict";
+  strict.deadline = std::chrono::nanoseconds(1);
+  strict.period = std::chrono::milliseconds(1);
+  strict.max_jitter = std::chrono::milliseconds(1);
+  strict.min_separation = std::chrono::nanoseconds(0);
+  TimingConstraint relaxed = strict;
+  relaxed.name = "relaxed";
+  relaxed.deadline = std::chrono::seconds(10);
+  relaxed.period = std::chrono::seconds(10);
+
+  ComponentId component = analyzer->register_component("update_test");
+  auto deadline_met = [&]() {
+    TimingSample sample;
+    analyzer->stop_measurement(analyzer->start_measurement(component), sample);
+    return sample.deadline_met;
+  };
+
+  // Unconstrained, then each update is seen by the next measurement
+  ASSERT_TRUE(deadline_met());
+  ASSERT_TRUE(analyzer->configure_constraints(component, strict));
+  ASSERT_FALSE(deadline_met());
+  ASSERT_TRUE(analyzer->configure_constraints(component, relaxed));
+  ASSERT_TRUE(deadline_met());
+
+  // Measurements proceed while another thread keeps reconfiguring
+  std::atomic<bool> updating{true};
+  std::thread updater([&]() {
+    for (int i = 0; i < 200; ++i) {
+      analyzer->configure_constraints(component, (i % 2) ? strict : relaxed);
+    }
+    updating.store(false);
+  });
+  size_t concurrent = 0;
+  while (updating.load() || concurrent < 100) {
+    deadline_met();
+    ++concurrent;
+  }
+  updater.join();
+
+  ASSERT_TRUE(analyzer->configure_constraints(component, relaxed));
+  ASSERT_TRUE(deadline_met());
+  ASSERT_TRUE(analyzer->flush_violations(std::chrono::seconds(5)));
+
+  // No measurement was blocked out by the updates; only a sample that found
+  // its completion ring full is dropped, and it is counted
+  auto stats = analyzer->estimate_wcet("update_test");
+  uint64_t dropped = analyzer->get_measurement_statistics().samples_dropped;
+  ASSERT_EQ(concurrent + 4, stats.measurement_count + dropped);
+
+  std::cout << "✓ Constraint update test passed" << std::endl;
+}
+
+void test_realtime_configuration() {
+  std::cout << "Testing real-time configuration..." << std::endl;
+
+  std::vector<int> expected = {0, 1, 2, 3, 8, 10, 11};
+  ASSERT_TRUE(parse_cpu_list("0-3,8,10-11\n") == expected);
+  ASSERT_TRUE(parse_cpu_list("").empty());
+  ASSERT_TRUE(parse_cpu_list("3-1").empty());
+  ASSERT_FALSE(housekeeping_cpus().empty());
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  int caller_policy = 0;
+  sched_param caller_param{};
+  ASSERT_EQ(0, pthread_getschedparam(pthread_self(), &caller_policy,
+                                     &caller_param));
+
+  // Missing capabilities degrade the configuration instead of failing it
+  bool complete = analyzer->set_realtime_priority(true);
+  RealtimeStatus status = analyzer->get_realtime_status();
+  ASSERT_TRUE(status.enabled);
+  ASSERT_FALSE(status.cpus.empty());
+  ASSERT_TRUE(status.threads_configured >= 1); // The violation dispatcher
+  ASSERT_EQ(complete, status.warnings.empty());
+  ASSERT_EQ(status.scheduling_applied && status.affinity_applied &&
+                status.memory_locked,
+            complete);
+
+  // The calling thread keeps its own scheduling
+  int policy = 0;
+  sched_param param{};
+  ASSERT_EQ(0, pthread_getschedparam(pthread_self(), &policy, &param));
+  ASSERT_EQ(caller_policy, policy);
+
+  // Analyzer threads keep working under the configuration
+  auto id = analyzer->start_measurement("realtime_test");
+  ASSERT_TRUE(analyzer->stop_measurement(id).task_name == "realtime_test");
+  analyzer->generate_report(false);
+
+  analyzer->set_realtime_priority(false);
+  status = analyzer->get_realtime_status();
+  ASSERT_FALSE(status.enabled);
+  ASSERT_FALSE(status.memory_locked);
+
+  std::cout << "✓ Real-time configuration test passed ("
+            << (complete ? "fully applied" : "degraded") << ")" << std::endl;
+}
+
+void test_sampling_engine() {
+  std::cout << "Testing sampling engine..." << std::endl;
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  ASSERT_FALSE(analyzer->configure_sampling_rate(200000.0));
+  ASSERT_TRUE(analyzer->configure_sampling_rate(2000.0));
+
+  std::atomic<int64_t> reads{0};
+  ComponentId probe = analyzer->register_probe(
+      "queue_depth", [&reads]() { return reads.fetch_add(1) % 100; });
+  ASSERT_TRUE(probe != INVALID_COMPONENT_ID);
+  ASSERT_TRUE(analyzer->register_probe("null_probe", nullptr) ==
+              INVALID_COMPONENT_ID);
+
+  ASSERT_TRUE(analyzer->start_sampling());
+  ASSERT_TRUE(analyzer->start_sampling()); // Already running
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  // A rate change takes effect while running
+  ASSERT_TRUE(analyzer->configure_sampling_rate(1000.0));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  SamplingStatistics running = analyzer->get_sampling_statistics();
+  ASSERT_TRUE(running.running);
+  ASSERT_EQ(1000.0, running.sample_rate);
+  analyzer->stop_sampling();
+
+  SamplingStatistics stats = analyzer->get_sampling_statistics();
+  ASSERT_FALSE(stats.running);
+  ASSERT_TRUE(stats.ticks > 0);
+  ASSERT_TRUE(stats.p99_wakeup_latency <= stats.max_wakeup_latency);
+
+  // One sample per tick, with the probe value as the execution time
+  auto wcet = analyzer->estimate_wcet("queue_depth", 0.99);
+  ASSERT_EQ(static_cast<size_t>(reads.load()), wcet.measurement_count);
+  ASSERT_EQ(stats.ticks, static_cast<uint64_t>(reads.load()));
+  ASSERT_TRUE(wcet.max_execution_time <= std::chrono::nanoseconds(99));
+
+  // Unregistered probes are no longer read
+  ASSERT_TRUE(analyzer->unregister_probe(probe));
+  ASSERT_FALSE(analyzer->unregister_probe(probe));
+  int64_t before = reads.load();
+  ASSERT_TRUE(analyzer->start_sampling());
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  analyzer->stop_sampling();
+  ASSERT_EQ(before, reads.load());
+
+  std::cout << "✓ Sampling engine test passed (" << stats.ticks
+            << " ticks, " << stats.missed_ticks << " missed, p99 wakeup "
+            << stats.p99_wakeup_latency.count() << " ns)" << std::endl;
+}
+
+struct ScopedTimingTag {
+  static constexpr const char *name() { return "scoped_timing"; }
+};
+
+void test_scoped_timing() {
+  std::cout << "Testing scoped timing..." << std::endl;
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  for (int i = 0; i < 100; ++i) {
+    ScopedTiming<ScopedTimingTag> timing(*analyzer);
+  }
+  {
+    IVV_SCOPED_TIMING(*analyzer, "scoped_macro");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+
+  // A second analyzer gets its own binding for the same tag
+  auto other = TimingAnalyzer::create();
+  ASSERT_TRUE(other->initialize());
+  other->register_component("other_first");
+  { ScopedTiming<ScopedTimingTag> timing(*other); }
+
+  auto stats = analyzer->estimate_wcet("scoped_timing", 0.99);
+  auto macro = analyzer->estimate_wcet("scoped_macro", 0.99);
+  auto other_stats = other->estimate_wcet("scoped_timing", 0.99);
+#if IVV_TIMING_INSTRUMENTATION
+  ASSERT_EQ(static_cast<size_t>(100), stats.measurement_count);
+  ASSERT_EQ(static_cast<size_t>(1), macro.measurement_count);
+  ASSERT_TRUE(macro.min_execution_time >= std::chrono::milliseconds(2));
+  ASSERT_EQ(static_cast<size_t>(1), other_stats.measurement_count);
+  ASSERT_EQ(static_cast<size_t>(0),
+            other->estimate_wcet("other_first", 0.99).measurement_count);
+#else
+  ASSERT_EQ(static_cast<size_t>(0), stats.measurement_count);
+  ASSERT_EQ(static_cast<size_t>(0), macro.measurement_count);
+  ASSERT_EQ(static_cast<size_t>(0), other_stats.measurement_count);
+#endif
+
+  // Direct tick recording drops unknown components
+  uint64_t start = analyzer->read_ticks();
+  analyzer->record_ticks(INVALID_COMPONENT_ID, start, analyzer->read_ticks());
+  analyzer->record_ticks(9999, start, analyzer->read_ticks());
+
+  // Recorded ticks are judged against the constraint when ingested;
+  // steady_clock ticks are nanoseconds
+  TimingConstraint constraint;
+  constraint.name = "ticked_constraint";
+  constraint.deadline = std::chrono::milliseconds(1);
+  constraint.period = std::chrono::milliseconds(10);
+  constraint.max_jitter = std::chrono::seconds(1);
+  constraint.min_separation = std::chrono::nanoseconds(0);
+  ComponentId ticked = analyzer->register_component("ticked");
+  ASSERT_TRUE(analyzer->configure_constraints("ticked", constraint));
+  auto before = analyzer->get_violation_dispatch_statistics();
+  start = analyzer->read_ticks();
+  analyzer->record_ticks(ticked, start, start + 2000000);
+  analyzer->record_ticks(ticked, start + 10000000, start + 10001000);
+  ASSERT_TRUE(analyzer->flush_violations());
+  auto after = analyzer->get_violation_dispatch_statistics();
+  ASSERT_EQ(before.queued + 1, after.queued);
+  ASSERT_EQ(before.dispatched + 1, after.dispatched);
+  auto compliance = analyzer->analyze_deadline_compliance(
+      "ticked", std::chrono::seconds(60));
+  ASSERT_EQ(static_cast<size_t>(2), compliance.measurement_count);
+  ASSERT_TRUE(std::abs(compliance.deadline_miss_rate - 0.5) < 1e-9);
+
+  std::cout << "✓ Scoped timing test passed" << std::endl;
+}
+
+void test_nested_spans() {
+  std::cout << "Testing nested spans..." << std::endl;
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  ComponentId epoch = analyzer->register_component("epoch");
+  ComponentId frame = analyzer->register_component("frame");
+  ComponentId stage = analyzer->register_component("stage");
+
+  // epoch > 2 x frame > 2 x stage
+  TimingSample epoch_sample;
+  TimingSample frame_sample;
+  TimingSample stage_sample;
+  uint64_t epoch_id = analyzer->start_measurement(epoch);
+  for (int f = 0; f < 2; ++f) {
+    uint64_t frame_id = analyzer->start_measurement(frame);
+    for (int s = 0; s < 2; ++s) {
+      uint64_t stage_id = analyzer->start_measurement(stage);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      ASSERT_TRUE(analyzer->stop_measurement(stage_id, stage_sample));
+      ASSERT_EQ(frame, stage_sample.parent);
+      ASSERT_EQ(stage_sample.execution_time.count(),
+                stage_sample.self_time.count());
+    }
+    ASSERT_TRUE(analyzer->stop_measurement(frame_id, frame_sample));
+    ASSERT_EQ(epoch, frame_sample.parent);
+    ASSERT_TRUE(frame_sample.self_time <
+                frame_sample.execution_time - std::chrono::milliseconds(2));
+  }
+  ASSERT_TRUE(analyzer->stop_measurement(epoch_id, epoch_sample));
+  ASSERT_EQ(INVALID_COMPONENT_ID, epoch_sample.parent);
+
+  // Inclusive time of the children accounts for the rest of the parent
+  auto report = analyzer->generate_report(false);
+  std::map<std::string, PerformanceStatistics> stats;
+  for (const auto &entry : report.component_stats) {
+    stats[entry.component_name] = entry;
+  }
+  auto tolerance = std::chrono::microseconds(10);
+  ASSERT_EQ(epoch_sample.execution_time.count(),
+            stats["epoch"].inclusive_time.count());
+  ASSERT_TRUE(std::chrono::abs(stats["epoch"].exclusive_time +
+                               stats["frame"].inclusive_time -
+                               stats["epoch"].inclusive_time) < tolerance);
+  ASSERT_TRUE(std::chrono::abs(stats["frame"].exclusive_time +
+                               stats["stage"].inclusive_time -
+                               stats["frame"].inclusive_time) < tolerance);
+  ASSERT_EQ(stats["stage"].inclusive_time.count(),
+            stats["stage"].exclusive_time.count());
+
+  ASSERT_EQ(static_cast<size_t>(3), report.call_tree.size());
+  const CallTreeNode &root = report.call_tree[0];
+  const CallTreeNode &middle = report.call_tree[1];
+  const CallTreeNode &leaf = report.call_tree[2];
+  ASSERT_EQ(std::string("epoch"), root.path);
+  ASSERT_EQ(static_cast<std::ptrdiff_t>(-1), root.parent_index);
+  ASSERT_EQ(std::string("epoch/frame"), middle.path);
+  ASSERT_EQ(static_cast<std::ptrdiff_t>(0), middle.parent_index);
+  ASSERT_EQ(static_cast<uint64_t>(2), middle.calls);
+  ASSERT_EQ(std::string("epoch/frame/stage"), leaf.path);
+  ASSERT_EQ(static_cast<size_t>(2), leaf.depth);
+  ASSERT_EQ(static_cast<uint64_t>(4), leaf.calls);
+  ASSERT_EQ(stats["stage"].inclusive_time.count(),
+            leaf.inclusive_time.count());
+
+  // A recursive span is counted once in its component's inclusive time,
+  // and the string API names the parent
+  analyzer->clear_measurements();
+  uint64_t outer = analyzer->start_measurement("epoch");
+  uint64_t inner = analyzer->start_measurement("epoch");
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  TimingMeasurement inner_result = analyzer->stop_measurement(inner);
+  TimingMeasurement outer_result = analyzer->stop_measurement(outer);
+  ASSERT_EQ(std::string("epoch"), inner_result.parent_task_name);
+  ASSERT_TRUE(outer_result.parent_task_name.empty());
+  auto recursive = analyzer->estimate_wcet("epoch", 0.99);
+  ASSERT_EQ(outer_result.execution_time.count(),
+            recursive.inclusive_time.count());
+  ASSERT_EQ(static_cast<size_t>(2), analyzer->get_call_tree().size());
+
+  // Out-of-order stops and spans left in flight do not corrupt the stack
+  analyzer->clear_measurements();
+  uint64_t first = analyzer->start_measurement(frame);
+  uint64_t second = analyzer->start_measurement(stage);
+  analyzer->stop_measurement(first);
+  analyzer->stop_measurement(second);
+  analyzer->start_measurement(epoch);
+  analyzer->clear_measurements();
+  uint64_t after = analyzer->start_measurement(stage);
+  ASSERT_TRUE(analyzer->stop_measurement(after, stage_sample));
+  ASSERT_EQ(INVALID_COMPONENT_ID, stage_sample.parent);
+
+  std::cout << "✓ Nested spans test passed" << std::endl;
+}
+
+void test_shared_memory_collection() {
+  std::cout << "Testing shared memory collection..." << std::endl;
+
+  // Unique per run so parallel test runs do not share a segment
+  std::string segment = "/ivv_timing_test_" + std::to_string(getpid());
+  SharedMemoryConfig config;
+  config.producer_capacity = 4;
+  config.ring_capacity = 1024;
+  config.poll_interval = std::chrono::milliseconds(5);
+  config.liveness_timeout = std::chrono::milliseconds(500);
+
+  auto collector = TimingAnalyzer::create();
+  ASSERT_TRUE(collector->initialize());
+  TimingConstraint constraint;
+  constraint.name = "remote_task";
+  constraint.deadline = std::chrono::microseconds(100);
+  constraint.period = std::chrono::milliseconds(10);
+  constraint.max_jitter = std::chrono::milliseconds(1);
+  constraint.min_separation = std::chrono::nanoseconds(0);
+  ASSERT_TRUE(collector->configure_constraints("remote_task", constraint));
+  std::atomic<int> remote_misses{0};
+  collector->set_verification_callback(
+      [&](const TimingMeasurement &measurement, const TimingConstraint &) {
+        if (!measurement.deadline_met) {
+          remote_misses.fetch_add(1);
+        }
+        return measurement.deadline_met;
+      });
+  ASSERT_TRUE(collector->start_shared_collector(segment, config));
+  ASSERT_TRUE(collector->get_shared_memory_statistics().collecting);
+
+  // A producer analyzer; its samples are judged by the collector's
+  // constraints, which it does not have itself
+  auto producer = TimingAnalyzer::create();
+  ASSERT_TRUE(producer->initialize());
+  ASSERT_TRUE(producer->start_shared_export(segment, "producer", config));
+  ASSERT_TRUE(producer->get_shared_memory_statistics().export_attached);
+  ASSERT_TRUE(producer->get_shared_memory_statistics().exporting);
+  for (int i = 0; i < 5; ++i) {
+    uint64_t id = producer->start_measurement("remote_task");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    producer->stop_measurement(id);
+  }
+  producer->stop_shared_export();
+  ASSERT_TRUE(!producer->get_shared_memory_statistics().exporting);
+  ASSERT_EQ(static_cast<uint64_t>(5),
+            producer->get_shared_memory_statistics().records_exported);
+
+  auto wait_for = [&](auto condition) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition() && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return condition();
+  };
+  ASSERT_TRUE(wait_for([&]() {
+    SharedMemoryStatistics stats = collector->get_shared_memory_statistics();
+    return stats.records_collected == 5 && stats.producers_active == 0;
+  }));
+
+  // Start times landed in the collector's clock domain, inside the window
+  PerformanceStatistics remote = collector->analyze_deadline_compliance(
+      "remote_task", std::chrono::seconds(10));
+  ASSERT_EQ(static_cast<size_t>(5), remote.measurement_count);
+  ASSERT_TRUE(remote.min_execution_time >= std::chrono::milliseconds(1));
+  ASSERT_TRUE(remote.deadline_miss_rate == 1.0);
+
+  // Their misses reach the verification callback like local ones
+  ASSERT_TRUE(collector->flush_violations(std::chrono::seconds(5)));
+  ASSERT_EQ(5, remote_misses.load());
+
+  // A producer process that dies without detaching is reclaimed
+  std::string label = "forked";
+  std::string name = "forked_task";
+  pid_t child = fork();
+  ASSERT_TRUE(child >= 0);
+  if (child == 0) {
+    SharedTimingProducer forked;
+    TraceRecord record;
+    record.component = 1;
+    record.start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+    record.execution_ns = 50000;
+    bool queued = forked.attach(segment, label) &&
+                  forked.define_component(0, name) && forked.append(record);
+    _exit(queued ? 0 : 1);
+  }
+  int status = 0;
+  ASSERT_EQ(child, waitpid(child, &status, 0));
+  ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  ASSERT_TRUE(wait_for([&]() {
+    return collector->get_shared_memory_statistics().producers_lost == 1;
+  }));
+
+  SharedMemoryStatistics stats = collector->get_shared_memory_statistics();
+  ASSERT_EQ(static_cast<uint64_t>(2), stats.producers_attached);
+  ASSERT_EQ(static_cast<uint64_t>(6), stats.records_collected);
+  ASSERT_EQ(static_cast<size_t>(0), stats.producers_active);
+  ASSERT_EQ(static_cast<size_t>(1),
+            collector
+                ->analyze_deadline_compliance("forked_task",
+                                              std::chrono::seconds(10))
+                .measurement_count);
+
+  collector->stop_shared_collector();
+  ASSERT_TRUE(!collector->get_shared_memory_statistics().collecting);
+
+  // A stalled producer whose slot was reclaimed leaves the ring and
+  // dictionary of the slot's new owner alone
+  {
+    const std::string reclaimed = segment + "_reclaimed";
+    SharedTimingCollector owner;
+    ASSERT_TRUE(owner.create(reclaimed, 1, 16));
+    SharedTimingProducer stalled;
+    ASSERT_TRUE(stalled.attach(reclaimed, "stalled"));
+    owner.release(0);
+    SharedTimingProducer current;
+    ASSERT_TRUE(current.attach(reclaimed, "current"));
+
+    TraceRecord record;
+    record.component = 1;
+    record.execution_ns = 1000;
+    ASSERT_FALSE(stalled.define_component(0, "stalled_task"));
+    ASSERT_FALSE(stalled.append(record));
+    ASSERT_TRUE(current.define_component(0, "current_task"));
+    ASSERT_TRUE(current.append(record));
+
+    ASSERT_EQ(static_cast<uint64_t>(1), owner.tail(0));
+    uint32_t next_index = 0;
+    std::vector<SharedTimingCollector::Component> components;
+    owner.read_components(0, next_index, components);
+    ASSERT_EQ(static_cast<size_t>(1), components.size());
+    ASSERT_TRUE(components[0].name == "current_task");
+    ASSERT_EQ(static_cast<uint64_t>(0), owner.producer(0).dropped);
+
+    stalled.detach();
+    ASSERT_TRUE(owner.producer(0).state ==
+                SharedTimingCollector::SlotState::ACTIVE);
+    current.detach();
+  }
+  std::cout << "✓ Shared memory collection test passed" << std::endl;
+}
+
+void test_history_downsampling() {
+  std::cout << "Testing history downsampling..." << std::endl;
+
+  // One sample per 100 ms for five minutes, every tenth a deadline miss
+  RetentionPolicy policy;
+  policy.max_samples = 100;
+  policy.second_tier_age = std::chrono::seconds(10);
+  policy.minute_tier_age = std::chrono::hours(1);
+  SampleHistory history(1, policy);
+  SampleHistory expiring(1, [&]() {
+    RetentionPolicy short_lived = policy;
+    short_lived.minute_tier_age = std::chrono::minutes(2);
+    return short_lived;
+  }());
+
+  auto base = std::chrono::steady_clock::time_point(std::chrono::hours(1));
+  for (int64_t i = 0; i < 3000; ++i) {
+    TimingSample sample{};
+    sample.start_time = base + std::chrono::milliseconds(100 * i);
+    sample.execution_time = std::chrono::microseconds(100 + i % 50);
+    sample.deadline_met = (i % 10) != 0;
+    history.append(sample);
+    expiring.append(sample);
+  }
+
+  // Evicted samples are aggregated, not dropped
+  ASSERT_EQ(static_cast<size_t>(100), history.size());
+  ASSERT_EQ(static_cast<uint64_t>(2900), history.tiers().sample_count());
+
+  // Compaction leaves per-second aggregates only for the last ten seconds
+  history.compact();
+  size_t seconds = 0;
+  size_t minutes = 0;
+  RunningStatistics downsampled;
+  history.tiers().for_each_since(
+      0, [&](const HistoryTiers::Interval &interval) {
+        (interval.width_ns == 1000000000 ? seconds : minutes) += 1;
+        downsampled.merge(interval.stats);
+      });
+  ASSERT_TRUE(seconds <= 11);
+  ASSERT_EQ(static_cast<size_t>(5), minutes);
+  ASSERT_EQ(static_cast<uint64_t>(2900), downsampled.count);
+  ASSERT_EQ(static_cast<uint64_t>(290), downsampled.deadline_misses);
+  ASSERT_EQ(static_cast<int64_t>(100000), downsampled.min_ns);
+  ASSERT_EQ(static_cast<int64_t>(149000), downsampled.max_ns);
+
+  // Per-minute aggregates past their age expire
+  expiring.compact();
+  ASSERT_TRUE(expiring.tiers().expired_count() > 0);
+  ASSERT_EQ(static_cast<uint64_t>(2900), expiring.tiers().sample_count() +
+                                             expiring.tiers().expired_count());
+
+  std::cout << "✓ History downsampling test passed" << std::endl;
+}
+
+void test_long_window_compliance() {
+  std::cout << "Testing long-window deadline compliance..." << std::endl;
+
+  // Three hours at one sample per second ending now, alternately 1us met
+  // and 3us missed
+  const std::string path = "timing_trend_test.ivvtrace";
+  int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+  const int64_t samples = 3 * 3600;
+  {
+    TraceFileWriter writer;
+    ASSERT_TRUE(writer.open(path, samples));
+    ASSERT_TRUE(writer.define_component(1, "trend_task"));
+    for (int64_t i = 0; i < samples; ++i) {
+      TraceRecord record;
+      record.component = 1;
+      record.flags = (i % 2 == 0) ? kTraceFlagDeadlineMet : 0;
+      record.start_ns = now_ns - (samples - i) * 1000000000;
+      record.execution_ns = (i % 2 == 0) ? 1000 : 3000;
+      ASSERT_TRUE(writer.append(record));
+    }
+  }
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  analyzer->register_component("trend_task");
+  RetentionPolicy policy;
+  policy.max_samples = 600;
+  policy.second_tier_age = std::chrono::minutes(10);
+  policy.minute_tier_age = std::chrono::hours(6);
+  ASSERT_TRUE(analyzer->configure_retention("trend_task", policy));
+  ASSERT_TRUE(analyzer->import_trace(path));
+  std::remove(path.c_str());
+
+  // Long windows cover the downsampled samples as well
+  auto full = analyzer->analyze_deadline_compliance("trend_task",
+                                                    std::chrono::hours(4));
+  ASSERT_EQ(static_cast<size_t>(samples), full.measurement_count);
+  ASSERT_TRUE(std::abs(full.deadline_miss_rate - 0.5) < 1e-9);
+  ASSERT_EQ(std::chrono::nanoseconds(1000), full.min_execution_time);
+  ASSERT_EQ(std::chrono::nanoseconds(3000), full.max_execution_time);
+  ASSERT_TRUE(full.percentiles[1] >= std::chrono::nanoseconds(3000));
+
+  // Windows are resolved to the aggregate intervals
+  auto hour = analyzer->analyze_deadline_compliance("trend_task",
+                                                    std::chrono::hours(1));
+  ASSERT_TRUE(hour.measurement_count >= 3540 && hour.measurement_count <= 3600);
+
+  // The background pass rolls seconds older than ten minutes into minutes
+  std::this_thread::sleep_for(std::chrono::milliseconds(600));
+  auto trend = analyzer->get_history_trend("trend_task", std::chrono::hours(4));
+  uint64_t total = 0;
+  size_t seconds = 0;
+  bool ordered = true;
+  for (size_t i = 0; i < trend.size(); ++i) {
+    total += trend[i].measurement_count;
+    seconds += (trend[i].duration == std::chrono::seconds(1)) ? 1u : 0u;
+    ordered &= i == 0 || trend[i - 1].start_time < trend[i].start_time;
+  }
+  ASSERT_EQ(static_cast<uint64_t>(samples), total);
+  ASSERT_TRUE(ordered);
+  ASSERT_TRUE(seconds >= 600 && seconds <= 602);
+  ASSERT_EQ(std::chrono::nanoseconds(std::chrono::minutes(1)),
+            trend.front().duration);
+  ASSERT_EQ(static_cast<uint64_t>(60), trend[1].measurement_count);
+  ASSERT_EQ(static_cast<uint64_t>(30), trend[1].deadline_misses);
+  ASSERT_EQ(std::chrono::nanoseconds(3000), trend[1].p99_execution_time);
+
+  std::cout << "✓ Long-window deadline compliance test passed" << std::endl;
+}
+
+void test_coordinated_omission() {
+  std::cout << "Testing coordinated-omission correction..." << std::endl;
+
+  // A 10ms stall against a 1ms period also stands for the nine releases
+  // it delayed, waiting 9ms down to 1ms
+  LatencyHistogram histogram;
+  histogram.record_with_expected_interval(std::chrono::milliseconds(10),
+                                          std::chrono::milliseconds(1));
+  ASSERT_EQ(10u, histogram.total_count());
+  ASSERT_TRUE(histogram.min_value() <= std::chrono::milliseconds(1));
+  ASSERT_TRUE(histogram.max_value() >= std::chrono::milliseconds(10));
+
+  // A 1ms task stalling once for 100ms among 1000 releases
+  const std::string path = "timing_omission_test.ivvtrace";
+  int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+  const int64_t samples = 1000;
+  {
+    TraceFileWriter writer;
+    ASSERT_TRUE(writer.open(path, 2 * samples));
+    ASSERT_TRUE(writer.define_component(1, "omission_task"));
+    ASSERT_TRUE(writer.define_component(2, "plain_task"));
+    for (int64_t i = 0; i < samples; ++i) {
+      for (uint32_t component : {1u, 2u}) {
+        TraceRecord record;
+        record.component = component;
+        record.start_ns = now_ns - (samples - i) * 1000000;
+        record.execution_ns = (i == 800) ? 100000000 : 100000;
+        ASSERT_TRUE(writer.append(record));
+      }
+    }
+  }
+
+  auto analyzer = TimingAnalyzer::create();
+  ASSERT_TRUE(analyzer->initialize());
+  TimingConstraint constraint;
+  constraint.name = "omission_task";
+  constraint.deadline = std::chrono::milliseconds(1);
+  constraint.period = std::chrono::milliseconds(1);
+  constraint.max_jitter = std::chrono::nanoseconds(0);
+  constraint.min_separation = std::chrono::nanoseconds(0);
+  constraint.correct_coordinated_omission = true;
+  ASSERT_TRUE(analyzer->configure_constraints("omission_task", constraint));
+  analyzer->register_component("plain_task");
+
+  // Correction needs the period the releases were due at
+  TimingConstraint aperiodic = constraint;
+  aperiodic.period = std::chrono::nanoseconds(0);
+  ASSERT_FALSE(analyzer->configure_constraints("plain_task", aperiodic));
+
+  ASSERT_TRUE(analyzer->import_trace(path));
+  std::remove(path.c_str());
+
+  // Uncorrected percentiles hide the stall; corrected ones show the wait
+  auto full = analyzer->analyze_deadline_compliance("omission_task",
+                                                    std::chrono::hours(1));
+  ASSERT_EQ(static_cast<size_t>(samples), full.measurement_count);
+  ASSERT_EQ(static_cast<uint64_t>(samples + 99),
+            full.corrected_measurement_count);
+  ASSERT_EQ(3u, full.corrected_percentiles.size());
+  ASSERT_TRUE(full.percentiles[1] < std::chrono::milliseconds(1));
+  ASSERT_TRUE(full.corrected_percentiles[1] > std::chrono::milliseconds(50));
+
+  // Windows back-fill their own samples
+  auto recent = analyzer->analyze_deadline_compliance(
+      "omission_task", std::chrono::milliseconds(500));
+  ASSERT_TRUE(recent.measurement_count < static_cast<size_t>(samples));
+  ASSERT_EQ(recent.measurement_count + 99, recent.corrected_measurement_count);
+  ASSERT_TRUE(recent.corrected_percentiles[1] > std::chrono::milliseconds(50));
+
+  auto plain = analyzer->analyze_deadline_compliance("plain_task",
+                                                     std::chrono::hours(1));
+  ASSERT_TRUE(plain.corrected_percentiles.empty());
+  ASSERT_EQ(0u, plain.corrected_measurement_count);
+
+  // Switching correction off drops the corrected view
+  constraint.correct_coordinated_omission = false;
+  ASSERT_TRUE(analyzer->configure_constraints("omission_task", constraint));
+  full = analyzer->analyze_deadline_compliance("omission_task",
+                                               std::chrono::hours(1));
+  ASSERT_TRUE(full.corrected_percentiles.empty());
+
+  // Unknown components report neither view
+  for (const auto &unknown :
+       {analyzer->analyze_deadline_compliance("unknown_task",
+                                              std::chrono::hours(1)),
+        analyzer->measure_jitter("unknown_task", 10),
+        analyzer->estimate_wcet("unknown_task", 0.99)}) {
+    ASSERT_TRUE(unknown.component_name == "unknown_task");
+    ASSERT_EQ(static_cast<size_t>(0), unknown.measurement_count);
+    ASSERT_TRUE(unknown.percentiles.empty());
+    ASSERT_TRUE(unknown.corrected_percentiles.empty());
+    ASSERT_EQ(0u, unknown.corrected_measurement_count);
+  }
+
+  std::cout << "✓ Coordinated-omission correction test passed" << std::endl;
+}
+
 } // anonymous namespace
 
 // Main test runner
@@ -223,6 +1992,33 @@ int main() {
     test_jitter_measurement();
     test_report_generation();
     test_constraint_verification();
+    test_concurrent_measurements();
+    test_concurrent_windowed_history();
+    test_component_handles();
+    test_history_retention();
+    test_running_statistics();
+    test_latency_histogram();
+    test_incremental_jitter();
+    test_tsc_clock_source();
+    test_columnar_history();
+    test_time_indexed_history();
+    test_out_of_order_history();
+    test_latency_profiling();
+    test_resource_sampling();
+    test_performance_counters();
+    test_trace_file_round_trip();
+    test_trace_replay();
+    test_parallel_report();
+    test_violation_dispatch();
+    test_constraint_updates();
+    test_realtime_configuration();
+    test_sampling_engine();
+    test_scoped_timing();
+    test_nested_spans();
+    test_shared_memory_collection();
+    test_history_downsampling();
+    test_long_window_compliance();
+    test_coordinated_omission();
 
     std::cout << std::endl
               << "🎉 All TimingAnalyzer tests passed!" << std::endl;